@@ -87,6 +87,7 @@ void cRandom_Sound::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     // default values
     m_continuous = 0;
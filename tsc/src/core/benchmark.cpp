@@ -0,0 +1,376 @@
+/***************************************************************************
+ * benchmark.cpp  -  Headless level benchmark
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/main.hpp"
+#include "../core/benchmark.hpp"
+#include "../core/framerate.hpp"
+#include "../core/collision.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/file_parser.hpp"
+#include "../audio/audio.hpp"
+#include "../video/video.hpp"
+#include "../video/renderer.hpp"
+#include "../input/keyboard.hpp"
+#include "../input/joystick.hpp"
+#include "../input/input_log.hpp"
+#include "../level/level_manager.hpp"
+#include "../level/level.hpp"
+#include "../level/level_player.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../core/sprite_pool.hpp"
+#include "../enemies/furball.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cBenchmark *** *** *** *** *** *** *** *** *** *** *** */
+
+const float cBenchmark::m_regression_threshold = 10.0f;
+
+// update sections of the level mode
+static const struct {
+    const char* name;
+    performance_timer_type type;
+} benchmark_sections[] = {
+    {"input", PERF_UPDATE_PROCESS_INPUT},
+    {"level", PERF_UPDATE_LEVEL},
+    {"level_editor", PERF_UPDATE_LEVEL_EDITOR},
+    {"player", PERF_UPDATE_PLAYER},
+    {"player_collisions", PERF_UPDATE_PLAYER_COLLISIONS},
+    {"late_level", PERF_UPDATE_LATE_LEVEL},
+    {"level_collisions", PERF_UPDATE_LEVEL_COLLISIONS},
+    {"camera", PERF_UPDATE_CAMERA},
+    {"scripts", PERF_UPDATE_SCRIPTS},
+    {"script_gc", PERF_UPDATE_SCRIPT_GC}
+};
+
+cBenchmark::cBenchmark(void)
+{
+    m_ticks = 0;
+    m_fire = 0;
+    m_fire_enemies = 0;
+    m_load_us = 0;
+    m_collision_allocs = 0;
+    m_sprite_pool_allocs = 0;
+}
+
+cBenchmark::~cBenchmark(void)
+{
+    //
+}
+
+int cBenchmark::Run(void)
+{
+    cInput_Log input_log;
+
+    if (!m_input_file.empty() && !input_log.Load_From_File(m_input_file)) {
+        cerr << "Benchmark : could not load input log " << path_to_utf8(m_input_file) << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (pLevel_Manager->Get_Path(m_level_name).empty()) {
+        cerr << "Benchmark : level not found " << m_level_name << endl;
+        return EXIT_FAILURE;
+    }
+
+    /* Nothing is drawn and the window stays hidden. It is still created
+     * as the OpenGL context is needed to load the textures.
+    */
+    pVideo->mp_window->setVisible(false);
+    pAudio->Close();
+
+    // same results for every run
+    srand(0);
+    pFramerate->Set_Fixed_Timestep(0);
+    pFramerate->Set_Fixed_Speedfacor(1.0f);
+
+    // input only comes from the log
+    pKeyboard->Set_Event_Key_States(1);
+    pJoystick->Set_Event_Button_States(1);
+
+    // enter the level without fading
+    Game_Action = GA_ENTER_LEVEL;
+    Game_Mode_Type = MODE_TYPE_LEVEL_CUSTOM;
+    Game_Action_Data_Start = CEGUI::XMLAttributes();
+    Game_Action_Data_Middle = CEGUI::XMLAttributes();
+    Game_Action_Data_End = CEGUI::XMLAttributes();
+    Game_Action_Data_Middle.add("load_level", m_level_name);
+
+    const uint64_t load_start = TSC_GetMicroTicks();
+    Handle_Game_Events();
+    m_load_us = TSC_GetMicroTicks() - load_start;
+
+    if (Game_Mode != MODE_LEVEL || Game_Action != GA_NONE) {
+        cerr << "Benchmark : could not enter level " << m_level_name << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (m_fire) {
+        Init_Fire();
+    }
+
+    pFramerate->Reset();
+
+    const uint32_t collision_allocs_start = Get_Collision_Heap_Allocations();
+    const uint32_t sprite_pool_allocs_start = Get_Sprite_Pool_Allocations();
+    uint64_t total_us = 0;
+    uint32_t tick = 0;
+
+    for (; tick < m_ticks; tick++) {
+        // level finished, player died or game exited
+        if (game_exit || Game_Mode != MODE_LEVEL || Game_Action != GA_NONE) {
+            break;
+        }
+
+        const uint64_t tick_start = TSC_GetMicroTicks();
+        pFramerate->Start_Frame();
+
+        sf::Event evt;
+
+        while (input_log.Poll_Event(tick, evt)) {
+            if (evt.type == sf::Event::JoystickButtonPressed || evt.type == sf::Event::JoystickButtonReleased) {
+                evt.joystickButton.joystickId = pJoystick->m_current_joystick;
+            }
+            else if (evt.type == sf::Event::JoystickMoved) {
+                evt.joystickMove.joystickId = pJoystick->m_current_joystick;
+            }
+
+            Handle_Input_Global(evt);
+        }
+
+        // shoot as fast as the fireballs can be spawned
+        if (m_fire) {
+            pLevel_Player->m_shoot_counter = 0.0f;
+            pLevel_Player->Action_Shoot();
+        }
+
+        Update_Game_Step();
+        Collect_Script_Garbage();
+
+        // nothing gets rendered
+        pRenderer->Clear(1);
+
+        total_us += TSC_GetMicroTicks() - tick_start;
+
+        pFramerate->Update();
+    }
+
+    m_collision_allocs = Get_Collision_Heap_Allocations() - collision_allocs_start;
+    m_sprite_pool_allocs = Get_Sprite_Pool_Allocations() - sprite_pool_allocs_start;
+
+    if (tick < m_ticks) {
+        cout << "Benchmark : level left after " << tick << " of " << m_ticks << " ticks" << endl;
+    }
+
+    if (tick == 0) {
+        return EXIT_FAILURE;
+    }
+
+    ResultMap results = Print_Results(tick, total_us);
+
+    if (!m_result_file.empty()) {
+        Compare_Results(results);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void cBenchmark::Init_Fire(void) const
+{
+    pLevel_Player->Set_Type(ALEX_FIRE, 0, 0);
+
+    // rows of enemies in the shooting direction
+    const float dir = (pLevel_Player->m_direction == DIR_LEFT) ? -1.0f : 1.0f;
+    const float start_x = pLevel_Player->m_pos_x + (dir * 200.0f);
+
+    for (unsigned int i = 0; i < m_fire_enemies; i++) {
+        cFurball* furball = new cFurball(pActive_Level->m_sprite_manager);
+        furball->Set_Pos(start_x + (dir * (i % 10) * 60.0f), pLevel_Player->m_pos_y - ((i / 10) * 60.0f), 1);
+        furball->Set_Direction(dir < 0.0f ? DIR_RIGHT : DIR_LEFT);
+        pActive_Level->m_sprite_manager->Add(furball);
+    }
+}
+
+// counts the parsed lines
+class cBenchmark_Parser : public cFile_parser {
+public:
+    cBenchmark_Parser(void)
+    {
+        m_lines = 0;
+        m_part_count = 0;
+    }
+
+    virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+    {
+        m_lines++;
+        m_part_count += count;
+        return 1;
+    }
+
+    uint32_t m_lines;
+    uint32_t m_part_count;
+};
+
+int cBenchmark::Run_Parser(const fs::path& dir)
+{
+    static const char* file_types[] = {".settings", ".imgset", ".txt"};
+    // the first round reads the files into the system cache
+    static const unsigned int rounds = 5;
+
+    vector<fs::path> files;
+
+    for (unsigned int i = 0; i < sizeof(file_types) / sizeof(file_types[0]); i++) {
+        vector<fs::path> type_files = Get_Directory_Files(dir, file_types[i]);
+        files.insert(files.end(), type_files.begin(), type_files.end());
+    }
+
+    if (files.empty()) {
+        cerr << "Benchmark : no files to parse in " << path_to_utf8(dir) << endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t best_us = 0;
+    uint32_t lines = 0;
+    uint32_t parts = 0;
+
+    for (unsigned int round = 0; round < rounds; round++) {
+        lines = 0;
+        parts = 0;
+
+        const uint64_t start = TSC_GetMicroTicks();
+
+        for (vector<fs::path>::const_iterator itr = files.begin(); itr != files.end(); ++itr) {
+            cBenchmark_Parser parser;
+            parser.Parse(*itr);
+
+            lines += parser.m_lines;
+            parts += parser.m_part_count;
+        }
+
+        const uint64_t round_us = TSC_GetMicroTicks() - start;
+
+        if (round == 0 || round_us < best_us) {
+            best_us = round_us;
+        }
+    }
+
+    cout << "Benchmark : parsed " << files.size() << " files with " << lines << " lines and " << parts << " parts in " << path_to_utf8(dir) << endl;
+    cout << std::fixed << std::setprecision(2);
+    cout << "  " << std::left << std::setw(20) << "parse" << std::right << std::setw(12) << (static_cast<float>(best_us) / 1000.0f) << " ms" << endl;
+    cout << "  " << std::left << std::setw(20) << "per_file" << std::right << std::setw(12) << (static_cast<float>(best_us) / files.size()) << " us" << endl;
+
+    return EXIT_SUCCESS;
+}
+
+cBenchmark::ResultMap cBenchmark::Print_Results(uint32_t ticks, uint64_t total_us) const
+{
+    ResultMap results;
+
+    cout << "Benchmark : " << m_level_name << " " << ticks << " ticks" << endl;
+    cout << std::fixed << std::setprecision(2);
+
+    // level loading
+    const float load_ms = static_cast<float>(m_load_us) / 1000.0f;
+
+    cout << "  " << std::left << std::setw(20) << "load" << std::right << std::setw(12) << load_ms << " ms" << endl;
+    results["load"] = load_ms;
+
+    for (unsigned int i = 0; i < sizeof(benchmark_sections) / sizeof(benchmark_sections[0]); i++) {
+        const cPerformance_Timer* timer = pFramerate->m_perf_timer[benchmark_sections[i].type];
+        const float us_per_tick = static_cast<float>(timer->total_us) / ticks;
+
+        cout << "  " << std::left << std::setw(20) << benchmark_sections[i].name << std::right << std::setw(12) << us_per_tick << " us/tick" << endl;
+        results[benchmark_sections[i].name] = us_per_tick;
+    }
+
+    // should stay near zero once the collision free lists are filled
+    const float allocs_per_tick = static_cast<float>(m_collision_allocs) / ticks;
+
+    cout << "  " << std::left << std::setw(20) << "collision_allocs" << std::right << std::setw(12) << allocs_per_tick << " allocs/tick" << endl;
+    results["collision_allocs"] = allocs_per_tick;
+
+    // should stay near zero once the sprite pools are filled
+    const float pool_allocs_per_tick = static_cast<float>(m_sprite_pool_allocs) / ticks;
+
+    cout << "  " << std::left << std::setw(20) << "sprite_pool_allocs" << std::right << std::setw(12) << pool_allocs_per_tick << " allocs/tick" << endl;
+    results["sprite_pool_allocs"] = pool_allocs_per_tick;
+
+    const float total_per_tick = static_cast<float>(total_us) / ticks;
+
+    cout << "  " << std::left << std::setw(20) << "total" << std::right << std::setw(12) << total_per_tick << " us/tick" << endl;
+    results["total"] = total_per_tick;
+
+    return results;
+}
+
+void cBenchmark::Compare_Results(const ResultMap& results) const
+{
+    // previous results
+    fs::ifstream ifs(m_result_file, ios::in);
+
+    if (ifs) {
+        std::string name;
+        float previous;
+        bool regression = 0;
+
+        cout << "Compared with " << path_to_utf8(m_result_file) << " :" << endl;
+
+        while (ifs >> name >> previous) {
+            ResultMap::const_iterator itr = results.find(name);
+
+            if (itr == results.end() || previous <= 0.0f) {
+                continue;
+            }
+
+            const float change = ((itr->second - previous) / previous) * 100.0f;
+
+            cout << "  " << std::left << std::setw(20) << name << std::right << std::setw(11) << std::showpos << change << std::noshowpos << " %";
+
+            if (change > m_regression_threshold) {
+                cout << "  regression";
+                regression = 1;
+            }
+
+            cout << endl;
+        }
+
+        if (regression) {
+            cout << "Benchmark : " << m_level_name << " got slower" << endl;
+        }
+
+        ifs.close();
+    }
+
+    // save for the next run
+    fs::ofstream ofs(m_result_file, ios::out | ios::trunc);
+
+    if (!ofs) {
+        cerr << "Benchmark : could not write results to " << path_to_utf8(m_result_file) << endl;
+        return;
+    }
+
+    for (ResultMap::const_iterator itr = results.begin(); itr != results.end(); ++itr) {
+        ofs << itr->first << " " << itr->second << endl;
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
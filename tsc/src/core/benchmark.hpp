@@ -0,0 +1,90 @@
+/***************************************************************************
+ * benchmark.hpp  -  Headless level benchmark
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_BENCHMARK_HPP
+#define TSC_BENCHMARK_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cBenchmark *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Runs a level for a fixed number of ticks without drawing
+     *
+     * The speed factor is fixed and the random numbers are seeded with
+     * a constant so every run does the same work. Player input is read
+     * from an input log. The time spent in each update section is printed
+     * and compared against the result file of the previous run.
+    */
+    class cBenchmark {
+    public:
+        cBenchmark(void);
+        ~cBenchmark(void);
+
+        /* Run the benchmark
+         * must be called after Init_Game()
+         * returns the exit status for the process
+        */
+        int Run(void);
+
+        /* Parse all settings, image set and text files in the directory tree
+         * does not need Init_Game()
+         * returns the exit status for the process
+        */
+        static int Run_Parser(const boost::filesystem::path& dir);
+
+        // level to run
+        std::string m_level_name;
+        // number of game ticks to run
+        unsigned int m_ticks;
+        // input log with the player input or empty
+        boost::filesystem::path m_input_file;
+        // file to compare with and to save the results to or empty
+        boost::filesystem::path m_result_file;
+        /* if set the player shoots fireballs every tick
+         * through the given number of enemies placed in front of the player
+        */
+        bool m_fire;
+        unsigned int m_fire_enemies;
+
+        // slowdown in percent reported as regression
+        static const float m_regression_threshold;
+
+    private:
+        typedef std::map<std::string, float> ResultMap;
+
+        /* Print the timing of all sections and return them
+         * the level loading in milliseconds and the update sections in microseconds per tick
+        */
+        ResultMap Print_Results(uint32_t ticks, uint64_t total_us) const;
+        // Print the difference to the previous results and save the new ones
+        void Compare_Results(const ResultMap& results) const;
+        // Give the player fire power and place the enemies to shoot at
+        void Init_Fire(void) const;
+
+        // time needed to load and enter the level
+        uint64_t m_load_us;
+        // collision objects allocated from the heap while running
+        uint32_t m_collision_allocs;
+        // pooled sprites allocated from the heap while running
+        uint32_t m_sprite_pool_allocs;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
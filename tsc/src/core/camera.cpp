@@ -45,6 +45,12 @@ cCamera::cCamera(cSprite_Manager* sprite_manager)
 
     m_fixed_hor_vel = 0.0f;
 
+    m_interp_x = 0.0f;
+    m_interp_y = 0.0f;
+    m_interp_real_x = 0.0f;
+    m_interp_real_y = 0.0f;
+    m_interp_applied = 0;
+
     // default camera limit
     Reset_Limits();
 }
@@ -144,13 +150,11 @@ bool cCamera::Move_to_Position_Gradually(const float pos_x, const float pos_y, c
         }
 
         // keep particles on screen
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            cSprite* obj = (*itr);
+        const cSprite_List& emitters = m_sprite_manager->Get_Objects_by_Type(TYPE_PARTICLE_EMITTER);
 
-            if (obj->m_type == TYPE_PARTICLE_EMITTER) {
-                cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(obj);
-                emitter->Update_Position();
-            }
+        for (cSprite_List::const_iterator itr = emitters.begin(); itr != emitters.end(); ++itr) {
+            cParticle_Emitter* emitter = static_cast<cParticle_Emitter*>(*itr);
+            emitter->Update_Position();
         }
 
         // update audio
@@ -401,6 +405,42 @@ void cCamera::Update_Position(void) const
     }
 }
 
+void cCamera::Store_Interpolation_Pos(void)
+{
+    m_interp_x = m_x;
+    m_interp_y = m_y;
+}
+
+void cCamera::Apply_Interpolation_Pos(const float alpha)
+{
+    if (m_interp_applied) {
+        return;
+    }
+
+    // jumped e.g. on a level entry, do not show the way between
+    if (fabs(m_x - m_interp_x) > 100.0f || fabs(m_y - m_interp_y) > 100.0f) {
+        return;
+    }
+
+    m_interp_real_x = m_x;
+    m_interp_real_y = m_y;
+    m_interp_applied = 1;
+
+    m_x = m_interp_x + ((m_interp_real_x - m_interp_x) * alpha);
+    m_y = m_interp_y + ((m_interp_real_y - m_interp_y) * alpha);
+}
+
+void cCamera::Restore_Interpolation_Pos(void)
+{
+    if (!m_interp_applied) {
+        return;
+    }
+
+    m_x = m_interp_real_x;
+    m_y = m_interp_real_y;
+    m_interp_applied = 0;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
@@ -104,6 +104,15 @@ namespace TSC {
         // update if position changed
         void Update_Position(void) const;
 
+        // Remember the current position as start of the drawing interpolation
+        void Store_Interpolation_Pos(void);
+        /* Move to the position between the interpolation start and the current position
+         * Restore_Interpolation_Pos() must be called after drawing
+        */
+        void Apply_Interpolation_Pos(const float alpha);
+        // Move back to the real position after drawing
+        void Restore_Interpolation_Pos(void);
+
         // the parent sprite manager
         cSprite_Manager* m_sprite_manager;
         // position
@@ -118,6 +127,13 @@ namespace TSC {
         // fixed horizontal scrolling velocity
         float m_fixed_hor_vel;
 
+        // position before the last fixed timestep
+        float m_interp_x, m_interp_y;
+        // real position while an interpolated position is applied
+        float m_interp_real_x, m_interp_real_y;
+        // if an interpolated position is applied
+        bool m_interp_applied;
+
         // default limits
         static const GL_rect m_default_limits;
     };
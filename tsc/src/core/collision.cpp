@@ -24,17 +24,91 @@
 
 namespace TSC {
 
+/* *** *** *** *** *** *** *** free lists *** *** *** *** *** *** *** *** *** *** */
+
+// memory of deleted collisions and collision lists
+static vector<void*> free_collisions;
+static vector<void*> free_collision_types;
+// emptied lists which keep their capacity
+static vector<cObjectCollision_List> free_collision_lists;
+// heap allocations since the start
+static uint32_t collision_heap_allocations = 0;
+
+static void* Alloc_From_Free_List(vector<void*>& free_list, size_t size)
+{
+    if (free_list.empty()) {
+        collision_heap_allocations++;
+        return ::operator new(size);
+    }
+
+    void* ptr = free_list.back();
+    free_list.pop_back();
+    return ptr;
+}
+
+uint32_t Get_Collision_Heap_Allocations(void)
+{
+    return collision_heap_allocations;
+}
+
+void Clear_Collision_Free_Lists(void)
+{
+    for (vector<void*>::iterator itr = free_collisions.begin(); itr != free_collisions.end(); ++itr) {
+        ::operator delete(*itr);
+    }
+    for (vector<void*>::iterator itr = free_collision_types.begin(); itr != free_collision_types.end(); ++itr) {
+        ::operator delete(*itr);
+    }
+
+    // swap to release the capacity
+    vector<void*>().swap(free_collisions);
+    vector<void*>().swap(free_collision_types);
+    vector<cObjectCollision_List>().swap(free_collision_lists);
+}
+
 /* *** *** *** *** *** *** *** cObjectCollisionType *** *** *** *** *** *** *** *** *** *** */
 
 cObjectCollisionType::cObjectCollisionType(void)
     : cObject_Manager<cObjectCollision>()
 {
-
+    if (!free_collision_lists.empty()) {
+        objects.swap(free_collision_lists.back());
+        free_collision_lists.pop_back();
+    }
 }
 
 cObjectCollisionType::~cObjectCollisionType(void)
 {
     Delete_All();
+
+    // keep the capacity for the next list
+    if (objects.capacity()) {
+        free_collision_lists.push_back(cObjectCollision_List());
+        free_collision_lists.back().swap(objects);
+    }
+}
+
+void* cObjectCollisionType::operator new(size_t size)
+{
+    if (size != sizeof(cObjectCollisionType)) {
+        return ::operator new(size);
+    }
+
+    return Alloc_From_Free_List(free_collision_types, size);
+}
+
+void cObjectCollisionType::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size != sizeof(cObjectCollisionType)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    free_collision_types.push_back(ptr);
 }
 
 void cObjectCollisionType::Add(cObjectCollision* obj)
@@ -121,6 +195,29 @@ cObjectCollision::~cObjectCollision(void)
     //
 }
 
+void* cObjectCollision::operator new(size_t size)
+{
+    if (size != sizeof(cObjectCollision)) {
+        return ::operator new(size);
+    }
+
+    return Alloc_From_Free_List(free_collisions, size);
+}
+
+void cObjectCollision::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size != sizeof(cObjectCollision)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    free_collisions.push_back(ptr);
+}
+
 void cObjectCollision::Set_Direction(const cSprite* base, const cSprite* col)
 {
     m_direction = Get_Collision_Direction(base, col);
@@ -58,6 +58,12 @@ namespace TSC {
         ObjectDirection m_direction;
         // Colliding object array type
         ArrayType m_array;
+
+        /* Collisions are created and deleted every frame
+         * so their memory is reused
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
     };
 
     typedef vector<cObjectCollision*> cObjectCollision_List;
@@ -86,10 +92,25 @@ namespace TSC {
         cObjectCollision* Find_First(const ArrayType type);
         // returns the first found sprite if the given sprite type was found
         cObjectCollision* Find_First(const SpriteType type);
+
+        /* Collision lists are created and deleted every frame
+         * so their memory and the list capacity are reused
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
     };
 
     /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
 
+    /* Returns the number of collisions and collision lists
+     * which could not be reused and were allocated from the heap
+    */
+    uint32_t Get_Collision_Heap_Allocations(void);
+    /* Give the memory of the reusable collisions and collision lists back to the heap
+     * e.g. after a level was unloaded
+    */
+    void Clear_Collision_Free_Lists(void);
+
     /* Returns the collision direction
      * base - the base sprite
      * col - the colliding sprite
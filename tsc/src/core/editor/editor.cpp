@@ -42,6 +42,7 @@ cEditor::cEditor()
     m_menu_filename = boost::filesystem::path(path_to_utf8("Needs to be set by subclasses"));
     m_editor_item_tag = "Must be set by subclass";
     m_help_window_visible = false;
+    m_items_loaded = false;
     m_object_config_pane_shown = false;
     mp_edited_sprite_manager = NULL;
 }
@@ -103,13 +104,8 @@ void cEditor::Init(void)
     parse_menu_file();
     populate_menu();
 
-    /* Fill in the creatable objects for each menu entry; first the
-     * image items (= static sprites with a .settings file), then the
-     * special items (= everything else, such as enemies).  The
-     * function menu entries are handled in the
-     * on_menu_selection_changed() event handler function. */
-    load_image_items();
-    load_special_items();
+    // The creatable objects are only needed once the editor is opened
+    m_items_loaded = false;
 
     mp_editor_tabpane->subscribeEvent(CEGUI::Window::EventMouseEntersArea, CEGUI::Event::Subscriber(&cEditor::on_mouse_enter, this));
     mp_editor_tabpane->subscribeEvent(CEGUI::Window::EventMouseLeavesArea, CEGUI::Event::Subscriber(&cEditor::on_mouse_leave, this));
@@ -130,6 +126,9 @@ void cEditor::Unload(void)
     for(iter=m_menu_entries.begin(); iter != m_menu_entries.end(); iter++)
         delete *iter;
 
+    m_menu_entries.clear();
+    m_items_loaded = false;
+
     if (mp_editor_root) {
         CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow()->removeChild(mp_editor_root);
         CEGUI::WindowManager::getSingleton().destroyWindow(mp_editor_root); // destroys child windows
@@ -157,6 +156,17 @@ void cEditor::Enable(cSprite_Manager* p_edited_sprite_manager)
     // TRANS: displayed to the user when opening the editor
     Draw_Static_Text(_("Loading"), &orange, NULL, 0);
 
+    /* Fill in the creatable objects for each menu entry; first the
+     * image items (= static sprites with a .settings file), then the
+     * special items (= everything else, such as enemies).  The
+     * function menu entries are handled in the
+     * on_menu_selection_changed() event handler function. */
+    if (!m_items_loaded) {
+        load_image_items();
+        load_special_items();
+        m_items_loaded = true;
+    }
+
     pAudio->Play_Sound("editor/enter.ogg");
     pMouseCursor->Set_Active(true);
 
@@ -193,6 +203,9 @@ void cEditor::Disable(void)
     mp_editor_root->hide();
     m_enabled = false;
     editor_enabled = false;
+
+    // the start rects follow the sprites while playing
+    mp_edited_sprite_manager->Clear_Editor_Index();
     mp_edited_sprite_manager = NULL;
 }
 
@@ -800,9 +813,9 @@ bool cEditor::Mouse_Move(const sf::Event& evt)
  * \returns false if the item was not added because the master tag
  * was missing, true otherwise.
  */
-bool cEditor::Try_Add_Image_Item(boost::filesystem::path settings_path, const cImage_Settings_Data* p_settings)
+bool cEditor::Try_Add_Image_Item(const cEditor_Catalog_Item& item)
 {
-    std::vector<std::string> available_tags = string_split(p_settings->m_editor_tags, ";");
+    std::vector<std::string> available_tags = string_split(item.m_editor_tags, ";");
 
     // If the master tag is not in the tag list, do not add this graphic to the
     // editor.
@@ -813,47 +826,27 @@ bool cEditor::Try_Add_Image_Item(boost::filesystem::path settings_path, const cI
     std::vector<cEditor_Menu_Entry*> target_menu_entries = find_target_menu_entries_for(available_tags);
     std::vector<cEditor_Menu_Entry*>::iterator iter;
 
-    // Find the PNG of this settings file. If an equally named .png exists,
-    // assume that file, otherwise check the settings 'base' property. If
-    // that also doesn't exist, that's an error.
-    boost::filesystem::path pixmap_path(settings_path); // Copy
-    pixmap_path.replace_extension(utf8_to_path(".png"));
-    if (!boost::filesystem::exists(pixmap_path)) {
-        if (p_settings->m_base.empty()) { // Error
-            std::cerr << "PNG file for settings file '" << path_to_utf8(settings_path) << "' not found (no .png found and no 'base' setting)." << std::endl;
-            std::cerr << "Using dummy image instead." << std::endl;
-            pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
-        }
-        else {
-            pixmap_path = pixmap_path.parent_path() / p_settings->m_base;
-            if (!boost::filesystem::exists(pixmap_path)) {
-                std::cerr << "PNG base file not found at '" << path_to_utf8(pixmap_path) << "'." << std::endl;
-                std::cerr << "Using dummy image instead." << std::endl;
-                pixmap_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
-            }
-        }
-    }
-
     // Create the template sprite that will be copied each time the
-    // user wants to add this object.
+    // user wants to add this object. Its image is set by the menu
+    // entry when it gets shown.
     // Cf. cSprite::cSprite(XmlAtributes) constructor on how to create
     // a sprite correctly.
     cSprite* p_template_sprite = new cSprite(&m_sprite_manager);
-    p_template_sprite->Set_Image(pVideo->Get_Surface(settings_path), 1); // FIXME: handle .imgset files?
-    p_template_sprite->Set_Massive_Type(p_settings->m_massive_type);
+    p_template_sprite->Set_Massive_Type(item.m_massive_type);
     m_sprite_manager.Add(p_template_sprite); // Memory-manage it
 
     // Add the graphics to the respective menu entries' GUI panels.
     for(iter=target_menu_entries.begin(); iter != target_menu_entries.end(); iter++) {
         (*iter)->Add_Item(
             p_template_sprite,
-            load_cegui_image(pixmap_path),
-            p_settings->m_name,
+            item.m_image_path,
+            item.m_name,
             CEGUI::Quaternion::eulerAnglesDegrees(
-                p_settings->m_rotation_x,
-                p_settings->m_rotation_y,
-                p_settings->m_rotation_z
-                )
+                item.m_rotation_x,
+                item.m_rotation_y,
+                item.m_rotation_z
+                ),
+            item.m_settings_path
             );
     }
 
@@ -897,7 +890,7 @@ bool cEditor::Try_Add_Special_Item(cSprite* p_sprite)
     for(iter=target_menu_entries.begin(); iter != target_menu_entries.end(); iter++) {
         (*iter)->Add_Item(
             p_sprite,
-            load_cegui_image(image_path),
+            image_path,
             p_sprite->Create_Name(),
             CEGUI::Quaternion::eulerAnglesDegrees(
                 p_sprite->m_start_rot_x,
@@ -988,32 +981,13 @@ void cEditor::populate_menu()
 /// Load the static .settings-file based objects into the editor menu.
 void cEditor::load_image_items()
 {
-    namespace fs = boost::filesystem;
-
-    std::vector<fs::path> image_files = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory(), ".settings");
-    std::vector<std::pair<fs::path, cImage_Settings_Data*>> items;
-
-    // Parse all the settings files
-    for (const fs::path& settings_path: image_files) {
-        cImage_Settings_Parser parser;
-        cImage_Settings_Data* p_settings = parser.Get(settings_path);
-        items.push_back(std::make_pair(settings_path, p_settings));
-    }
-
-    // Sort them by the name from the settings file's contents
-    std::sort(
-        items.begin(),
-        items.end(), [](std::pair<fs::path, cImage_Settings_Data*> a,
-                        std::pair<fs::path, cImage_Settings_Data*> b) {
-                         return std::get<1>(a)->m_name < std::get<1>(b)->m_name;
-                     });
+    // Parsed settings files sorted by name
+    cEditor_Catalog catalog;
+    catalog.Load();
 
     // Add them all to the editor's menu
-    for (std::pair<fs::path, cImage_Settings_Data*> pair: items) {
-        fs::path settings_path = std::get<0>(pair);
-        cImage_Settings_Data* p_settings = std::get<1>(pair);
-        Try_Add_Image_Item(settings_path, p_settings);
-        delete p_settings;
+    for (const cEditor_Catalog_Item& item: catalog.m_items) {
+        Try_Add_Image_Item(item);
     }
 }
 
@@ -1216,7 +1190,7 @@ std::string cEditor::load_cegui_image(boost::filesystem::path path)
     return escaped_path;
 }
 
-void cEditor_Menu_Entry::Add_Item(cSprite* p_template_sprite, std::string cegui_img_ident, std::string name, CEGUI::Quaternion rotation)
+void cEditor_Menu_Entry::Add_Item(cSprite* p_template_sprite, boost::filesystem::path image_path, std::string name, CEGUI::Quaternion rotation, boost::filesystem::path settings_path /* = boost::filesystem::path() */)
 {
     static const int labelheight = 24;
     static const int imageheight = 48; /* Also image width (square) */
@@ -1229,7 +1203,6 @@ void cEditor_Menu_Entry::Add_Item(cSprite* p_template_sprite, std::string cegui_
     p_label->setProperty("FrameEnabled", "False");
 
     CEGUI::Window* p_image = CEGUI::WindowManager::getSingleton().createWindow("TSCLook256/StaticImage"/* , std::string("image-of-") + name */);
-    p_image->setProperty("Image", cegui_img_ident);
     p_image->setSize(CEGUI::USize(CEGUI::UDim(0, imageheight), CEGUI::UDim(0, imageheight)));
     p_image->setPosition(CEGUI::UVector2(CEGUI::UDim(0.5, -imageheight/2) /* center on X */, CEGUI::UDim(0, m_element_y + labelheight)));
     p_image->setProperty("FrameEnabled", "False");
@@ -1244,6 +1217,31 @@ void cEditor_Menu_Entry::Add_Item(cSprite* p_template_sprite, std::string cegui_
 
     // Remember where we stopped for the next call.
     m_element_y += labelheight + imageheight + yskip;
+
+    // The image is set when the entry is shown
+    cPending_Item pending_item;
+    pending_item.mp_image = p_image;
+    pending_item.mp_template_sprite = p_template_sprite;
+    pending_item.m_image_path = image_path;
+    pending_item.m_settings_path = settings_path;
+    m_pending_items.push_back(pending_item);
+}
+
+/// Load the images of the items added since the last activation.
+void cEditor_Menu_Entry::load_pending_items()
+{
+    std::vector<cPending_Item>::iterator iter;
+
+    for(iter=m_pending_items.begin(); iter != m_pending_items.end(); iter++) {
+        iter->mp_image->setProperty("Image", cEditor::load_cegui_image(iter->m_image_path));
+
+        // Template sprites of image items may be shared by several entries
+        if (!iter->m_settings_path.empty() && !iter->mp_template_sprite->m_start_image) {
+            iter->mp_template_sprite->Set_Image(pVideo->Get_Surface(iter->m_settings_path), 1); // FIXME: handle .imgset files?
+        }
+    }
+
+    m_pending_items.clear();
 }
 
 /// Activate this entry's panel in the handed tabbook.
@@ -1251,6 +1249,9 @@ void cEditor_Menu_Entry::Activate(CEGUI::TabControl* p_tabcontrol)
 {
     CEGUI::Window* p_container = p_tabcontrol->getTabContents("editor_tab_items");
 
+    // Only the shown items need their images
+    load_pending_items();
+
     // Detach the current scrollable pane.
     CEGUI::ScrollablePane* p_current_pane = static_cast<CEGUI::ScrollablePane*>(p_container->getChildElementAtIdx(0));
     p_container->removeChild(p_current_pane);
@@ -1345,7 +1346,7 @@ void cEditor::Process_Input(void)
     }
 
     // Camera Movement
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right) || pJoystick->Right()) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::Right) || pJoystick->Right()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed, 0.0f);
         }
@@ -1353,7 +1354,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed, 0.0f);
         }
     }
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left) || pJoystick->Left()) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::Left) || pJoystick->Left()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(-(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed), 0.0f);
         }
@@ -1361,7 +1362,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(-(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed), 0.0f);
         }
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || pJoystick->Up()) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::Up) || pJoystick->Up()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(0.0f, -(CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed));
         }
@@ -1369,7 +1370,7 @@ void cEditor::Process_Input(void)
             pActive_Camera->Move(0.0f, -(CAMERA_SPEED * pFramerate->m_speed_factor * pPreferences->m_scroll_speed));
         }
     }
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || pJoystick->Down()) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::Down) || pJoystick->Down()) {
         if (pKeyboard->Is_Shift_Down()) {
             pActive_Camera->Move(0.0f, CAMERA_SPEED * pFramerate->m_speed_factor * 3 * pPreferences->m_scroll_speed);
         }
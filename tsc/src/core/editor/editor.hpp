@@ -17,13 +17,17 @@
 #ifndef TSC_EDITOR_HPP
 #define TSC_EDITOR_HPP
 
+#include "editor_catalog.hpp"
+
 namespace TSC {
     class cEditor_Menu_Entry {
     public:
         cEditor_Menu_Entry(std::string name);
         ~cEditor_Menu_Entry();
 
-        void Add_Item(cSprite* p_template_sprite, std::string cegui_img_ident, std::string name, CEGUI::Quaternion rotation); // FIXME: Must take std::vector<cSprite*> due to multi-sprite objects
+        /* The image is only loaded when the entry gets activated. If a settings
+         * file is given, the template sprite gets its image from it at that time. */
+        void Add_Item(cSprite* p_template_sprite, boost::filesystem::path image_path, std::string name, CEGUI::Quaternion rotation, boost::filesystem::path settings_path = boost::filesystem::path()); // FIXME: Must take std::vector<cSprite*> due to multi-sprite objects
         void Activate(CEGUI::TabControl* p_tabcontrol);
 
         inline void Set_Color(Color color){ m_color = color; }
@@ -51,6 +55,16 @@ namespace TSC {
         CEGUI::ScrollablePane* mp_tab_pane;
         int m_element_y;
 
+        // item images not loaded yet
+        struct cPending_Item {
+            CEGUI::Window* mp_image;
+            cSprite* mp_template_sprite;
+            boost::filesystem::path m_image_path;
+            boost::filesystem::path m_settings_path;
+        };
+        std::vector<cPending_Item> m_pending_items;
+
+        void load_pending_items();
         bool on_image_mouse_down(const CEGUI::EventArgs& ev);
     };
 
@@ -79,7 +93,7 @@ namespace TSC {
         /// Is the config panel shown to the user?
         inline bool Is_Config_Panel_Shown(){ return m_object_config_pane_shown; }
 
-        bool Try_Add_Image_Item(boost::filesystem::path settings_path, const cImage_Settings_Data* p_settings);
+        bool Try_Add_Image_Item(const cEditor_Catalog_Item& item);
         bool Try_Add_Special_Item(cSprite* p_sprite); // FIXME: Must take std::vector<cSprite*> due to multi-sprite objects
         void Select_Same_Object_Types(const cSprite* obj);
 
@@ -97,6 +111,9 @@ namespace TSC {
         virtual bool Mouse_Move(const sf::Event& evt);
         virtual bool Key_Down(const sf::Event& evt);
 
+        // Load the CEGUI image of the given file if not already done and return its identifier
+        static std::string load_cegui_image(boost::filesystem::path);
+
         bool m_enabled;
         bool m_object_config_pane_shown;
     protected:
@@ -143,6 +160,8 @@ namespace TSC {
         std::vector<CEGUI::Window*> m_editor_items;
         std::vector<cEditor_Menu_Entry*> m_menu_entries;
         bool m_help_window_visible;
+        // menu items are loaded on the first Enable()
+        bool m_items_loaded;
         const int CAMERA_SPEED = 35;
 
         void parse_menu_file();
@@ -153,7 +172,6 @@ namespace TSC {
         cSprite_List copy_direction(const cSprite_List& objects, const ObjectDirection dir) const;
         cSprite* copy_direction(const cSprite* obj, const ObjectDirection dir, int offset /* = 0 */) const;
         void replace_sprites(void);
-        std::string load_cegui_image(boost::filesystem::path);
         void update_status_bar();
         bool on_mouse_enter(const CEGUI::EventArgs& event);
         bool on_mouse_leave(const CEGUI::EventArgs& event);
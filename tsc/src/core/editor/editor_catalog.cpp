@@ -0,0 +1,228 @@
+/***************************************************************************
+ * editor_catalog.cpp - Cached list of the editor image items
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../global_basic.hpp"
+#include "../game_core.hpp"
+#include "../property_helper.hpp"
+#include "../math/utilities.hpp"
+#include "../filesystem/filesystem.hpp"
+#include "../filesystem/relative.hpp"
+#include "../filesystem/resource_manager.hpp"
+#include "../../video/img_settings.hpp"
+#include "editor_catalog.hpp"
+
+using namespace TSC;
+
+namespace fs = boost::filesystem;
+
+cEditor_Catalog::cEditor_Catalog(void)
+    : cFile_parser()
+{
+    m_file_dir_time = 0;
+    m_parse_error = 0;
+}
+
+cEditor_Catalog::~cEditor_Catalog(void)
+{
+    //
+}
+
+void cEditor_Catalog::Load(void)
+{
+    const fs::path filename = pResource_Manager->Get_User_Editor_Catalog_File();
+    const std::time_t dir_time = Get_Directories_Time(pResource_Manager->Get_Game_Pixmaps_Directory());
+
+    if (Load_From_File(filename, dir_time)) {
+        return;
+    }
+
+    Build();
+    Save_To_File(filename, dir_time);
+}
+
+bool cEditor_Catalog::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+{
+    if (parts[0].compare("directories") == 0) {
+        if (count != 2 || !Is_Valid_Number(parts[1], 0)) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        m_file_dir_time = static_cast<std::time_t>(string_to_int64(parts[1]));
+    }
+    else if (parts[0].compare("item") == 0) {
+        if (count < 8 || count > 9) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        for (unsigned int i = 4; i < 7; i++) {
+            if (!Is_Valid_Number(parts[i], 0)) {
+                m_parse_error = 1;
+                return 0;
+            }
+        }
+
+        const fs::path pixmaps_dir = pResource_Manager->Get_Game_Pixmaps_Directory();
+
+        cEditor_Catalog_Item item;
+        item.m_settings_path = pixmaps_dir / utf8_to_path(parts[1]);
+        item.m_image_path = pixmaps_dir / utf8_to_path(parts[2]);
+        item.m_massive_type = Get_Massive_Type_Id(parts[3]);
+        item.m_rotation_x = string_to_int(parts[4]);
+        item.m_rotation_y = string_to_int(parts[5]);
+        item.m_rotation_z = string_to_int(parts[6]);
+        item.m_editor_tags = parts[7];
+
+        if (count == 9) {
+            item.m_name = parts[8];
+        }
+
+        m_items.push_back(item);
+    }
+    else {
+        m_parse_error = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+std::time_t cEditor_Catalog::Get_Directories_Time(const fs::path& dir) const
+{
+    boost::system::error_code ec;
+    std::time_t latest = fs::last_write_time(dir, ec);
+
+    if (ec) {
+        return 0;
+    }
+
+    // a changed directory means added, removed or replaced files
+    for (fs::recursive_directory_iterator itr(dir, ec), end; !ec && itr != end; itr.increment(ec)) {
+        if (!fs::is_directory(itr->status())) {
+            continue;
+        }
+
+        const std::time_t dir_time = fs::last_write_time(itr->path(), ec);
+
+        if (!ec && dir_time > latest) {
+            latest = dir_time;
+        }
+    }
+
+    return latest;
+}
+
+void cEditor_Catalog::Build(void)
+{
+    m_items.clear();
+
+    std::vector<fs::path> settings_files = Get_Directory_Files(pResource_Manager->Get_Game_Pixmaps_Directory(), ".settings");
+
+    for (const fs::path& settings_path: settings_files) {
+        cImage_Settings_Data* p_settings = pSettingsParser->Get(settings_path);
+
+        // never shown in an editor
+        if (p_settings->m_editor_tags.empty()) {
+            delete p_settings;
+            continue;
+        }
+
+        cEditor_Catalog_Item item;
+        item.m_settings_path = settings_path;
+        item.m_editor_tags = p_settings->m_editor_tags;
+        item.m_name = p_settings->m_name;
+        item.m_massive_type = p_settings->m_massive_type;
+        item.m_rotation_x = p_settings->m_rotation_x;
+        item.m_rotation_y = p_settings->m_rotation_y;
+        item.m_rotation_z = p_settings->m_rotation_z;
+
+        // Find the PNG of this settings file. If an equally named .png exists,
+        // assume that file, otherwise check the settings 'base' property. If
+        // that also doesn't exist, that's an error.
+        item.m_image_path = settings_path;
+        item.m_image_path.replace_extension(utf8_to_path(".png"));
+        if (!fs::exists(item.m_image_path)) {
+            if (p_settings->m_base.empty()) { // Error
+                std::cerr << "PNG file for settings file '" << path_to_utf8(settings_path) << "' not found (no .png found and no 'base' setting)." << std::endl;
+                std::cerr << "Using dummy image instead." << std::endl;
+                item.m_image_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+            }
+            else {
+                item.m_image_path = item.m_image_path.parent_path() / p_settings->m_base;
+                if (!fs::exists(item.m_image_path)) {
+                    std::cerr << "PNG base file not found at '" << path_to_utf8(item.m_image_path) << "'." << std::endl;
+                    std::cerr << "Using dummy image instead." << std::endl;
+                    item.m_image_path = pResource_Manager->Get_Game_Pixmap("game/image_not_found.png");
+                }
+            }
+        }
+
+        m_items.push_back(item);
+        delete p_settings;
+    }
+
+    // Sort them by the name from the settings file's contents
+    std::stable_sort(
+        m_items.begin(),
+        m_items.end(), [](const cEditor_Catalog_Item& a, const cEditor_Catalog_Item& b) {
+                           return a.m_name < b.m_name;
+                       });
+}
+
+bool cEditor_Catalog::Load_From_File(const fs::path& filename, std::time_t dir_time)
+{
+    if (!File_Exists(filename)) {
+        return 0;
+    }
+
+    m_items.clear();
+    m_file_dir_time = 0;
+    m_parse_error = 0;
+
+    if (!Parse(filename) || m_parse_error || m_file_dir_time != dir_time) {
+        m_items.clear();
+        return 0;
+    }
+
+    return 1;
+}
+
+void cEditor_Catalog::Save_To_File(const fs::path& filename, std::time_t dir_time) const
+{
+    fs::ofstream ofs(filename, std::ios::out | std::ios::trunc);
+
+    if (!ofs) {
+        std::cerr << "Warning: Could not save the editor catalog to " << path_to_utf8(filename) << std::endl;
+        return;
+    }
+
+    const fs::path pixmaps_dir = pResource_Manager->Get_Game_Pixmaps_Directory();
+
+    ofs << "# Editor image items of " << path_to_utf8(pixmaps_dir) << std::endl;
+    ofs << "directories " << static_cast<int64_t>(dir_time) << std::endl;
+
+    for (const cEditor_Catalog_Item& item: m_items) {
+        ofs << "item " << path_to_utf8(fs_relative(pixmaps_dir, item.m_settings_path)) << " " << path_to_utf8(fs_relative(pixmaps_dir, item.m_image_path));
+        ofs << " " << Get_Massive_Type_Name(item.m_massive_type) << " " << item.m_rotation_x << " " << item.m_rotation_y << " " << item.m_rotation_z;
+        ofs << " " << item.m_editor_tags;
+
+        if (!item.m_name.empty()) {
+            ofs << " " << item.m_name;
+        }
+
+        ofs << std::endl;
+    }
+}
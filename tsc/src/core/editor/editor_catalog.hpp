@@ -0,0 +1,81 @@
+/***************************************************************************
+ * editor_catalog.hpp - Cached list of the editor image items
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_EDITOR_CATALOG_HPP
+#define TSC_EDITOR_CATALOG_HPP
+
+#include "../global_basic.hpp"
+#include "../global_game.hpp"
+#include "../file_parser.hpp"
+
+namespace TSC {
+
+    // An image item as shown in the editor menu
+    struct cEditor_Catalog_Item {
+        // settings file
+        boost::filesystem::path m_settings_path;
+        // image shown in the menu
+        boost::filesystem::path m_image_path;
+        std::string m_editor_tags;
+        std::string m_name;
+        MassiveType m_massive_type;
+        int m_rotation_x, m_rotation_y, m_rotation_z;
+    };
+
+    /* All .settings files with editor tags from the pixmaps directory
+     *
+     * Building it needs all settings files, so the result is saved into
+     * the user cache directory. The saved catalog is used as long as
+     * no directory in the pixmaps directory was modified. The file has
+     * one line per item :
+     * item <settings file> <image> <massive type> <rot x> <rot y> <rot z> <editor tags> [<name>]
+     * The paths are relative to the pixmaps directory.
+    */
+    class cEditor_Catalog : public cFile_parser {
+    public:
+        cEditor_Catalog(void);
+        virtual ~cEditor_Catalog(void);
+
+        // Load the saved catalog or build and save it if it is outdated
+        void Load(void);
+
+        // Handle one tokenized line
+        virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
+
+        typedef std::vector<cEditor_Catalog_Item> ItemList;
+        // sorted by name
+        ItemList m_items;
+
+    private:
+        // Return the latest modification time of the given directory and its sub-directories
+        std::time_t Get_Directories_Time(const boost::filesystem::path& dir) const;
+        // Build from the settings files
+        void Build(void);
+        /* Load the saved catalog
+         * returns false if it does not exist or was saved for other directories
+        */
+        bool Load_From_File(const boost::filesystem::path& filename, std::time_t dir_time);
+        // Save for the next start
+        void Save_To_File(const boost::filesystem::path& filename, std::time_t dir_time) const;
+
+        // directories time of the loaded file
+        std::time_t m_file_dir_time;
+        // set if a line could not be parsed
+        bool m_parse_error;
+    };
+
+}
+
+#endif // header guard
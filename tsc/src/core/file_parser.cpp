@@ -16,6 +16,7 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <cstring>
 
 #include "../core/global_basic.hpp"
 #include "../core/file_parser.hpp"
@@ -41,7 +42,7 @@ cFile_parser::~cFile_parser(void)
 
 bool cFile_parser::Parse(const fs::path& filename)
 {
-    fs::ifstream ifs(filename, ios::in);
+    fs::ifstream ifs(filename, ios::in | ios::binary);
 
     if (!ifs) {
         cerr << "Could not load data file : " << path_to_utf8(filename) << endl;
@@ -50,74 +51,107 @@ bool cFile_parser::Parse(const fs::path& filename)
 
     data_file = filename;
 
-    std::string line;
+    // read everything at once
+    ifs.seekg(0, ios::end);
+    const std::streamoff size = ifs.tellg();
+    ifs.seekg(0, ios::beg);
+
+    std::string buffer;
+
+    if (size > 0) {
+        buffer.resize(static_cast<size_t>(size));
+        ifs.read(&buffer[0], size);
+        buffer.resize(static_cast<size_t>(ifs.gcount()));
+    }
+
+    ifs.close();
+
+    const char* pos = buffer.data();
+    const char* buffer_end = pos + buffer.size();
     unsigned int line_num = 0;
 
-    while (std::getline(ifs, line)) {
+    while (pos < buffer_end) {
+        const char* line_end = static_cast<const char*>(memchr(pos, '\n', buffer_end - pos));
+
+        if (!line_end) {
+            line_end = buffer_end;
+        }
+
         line_num++;
-        Parse_Line(line, line_num);
+        Parse_Line(pos, line_end - pos, line_num);
+
+        pos = line_end + 1;
     }
 
     return 1;
 }
 
-bool cFile_parser::Parse_Line(std::string str_line, int line_num)
+bool cFile_parser::Parse_Line(const std::string& str_line, int line_num)
 {
-    if (str_line.empty()) {
-        return 1;
+    return Parse_Line(str_line.data(), str_line.size(), line_num);
+}
+
+bool cFile_parser::Parse_Line(const char* str_line, size_t length, int line_num)
+{
+    const char* line_end = str_line + length;
+
+    // remove trailing spaces
+    while (line_end > str_line && (line_end[-1] == ' ' || line_end[-1] == '\t' || line_end[-1] == '\r')) {
+        line_end--;
     }
 
-    // linux support
-    string_erase_all(str_line, '\r');
-    // no tabs
-    string_replace_all(str_line, "\t", " ");
     // remove beginning spaces
-    string_trim_from_begin(str_line, ' ');
-    // remove trailing spaces
-    string_trim_from_end(str_line, ' ');
+    const char* first = str_line;
+
+    while (first < line_end && (*first == ' ' || *first == '\t' || *first == '\r')) {
+        first++;
+    }
 
     // ignore empty lines and comments
-    if (str_line.empty() || *str_line.begin() == '#') {
+    if (first == line_end || *first == '#') {
         // no error
         return 1;
     }
 
-    std::string tempstr = str_line;
-    int count = 1;
-
-    // count spaces
-    while (tempstr.find(' ') != std::string::npos) {
-        tempstr.erase(tempstr.find(' ') , 1);
-        count++;
-    }
+    unsigned int part_count = 0;
+    const char* pos = first;
 
-    tempstr = str_line;
+    while (1) {
+        if (m_parts.size() <= part_count) {
+            m_parts.resize(part_count + 1);
+        }
 
-    std::string* parts = new std::string[ count + 1 ];
+        std::string& part = m_parts[part_count];
+        part.clear();
+        part_count++;
 
-    std::string::size_type len;
-    int part_count = 0;
+        // characters up to the next space
+        while (pos < line_end && *pos != ' ' && *pos != '\t') {
+            const char* run_end = pos;
 
-    while (count > 0) {
-        // get length of the part
-        len = tempstr.find_first_of(' ');
-        // create part
-        parts[part_count] = tempstr.substr(0, len);
-        // remove part from temp string
-        tempstr.erase(0, len + 1);
+            while (run_end < line_end && *run_end != ' ' && *run_end != '\t' && *run_end != '\r') {
+                run_end++;
+            }
 
-        part_count++;
-        count--;
-    }
+            part.append(pos, run_end - pos);
+            pos = run_end;
 
-    parts[part_count] = tempstr;
+            // linux support
+            while (pos < line_end && *pos == '\r') {
+                pos++;
+            }
+        }
 
-    // Message handler
-    bool success = HandleMessage(parts, part_count, line_num);
+        if (pos == line_end) {
+            break;
+        }
 
-    delete []parts;
+        // skip the space
+        pos++;
+    }
 
-    return success;
+    // Message handler
+    return HandleMessage(&m_parts[0], part_count, line_num);
 }
 
 bool cFile_parser::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
@@ -28,17 +28,32 @@ namespace TSC {
         cFile_parser(void);
         virtual ~cFile_parser(void);
 
-        // Parses the given file
+        /* Parses the given file
+         * the file is read at once
+        */
         bool Parse(const boost::filesystem::path& filename);
 
         // Tokenize a line
-        bool Parse_Line(std::string str_line, int line_num);
+        bool Parse_Line(const std::string& str_line, int line_num);
+        /* Tokenize a line
+         * carriage returns are ignored and tabs separate like spaces
+         * every space starts a new part and trailing spaces are ignored
+        */
+        bool Parse_Line(const char* str_line, size_t length, int line_num);
 
-        // Handle one tokenized line
+        /* Handle one tokenized line
+         * the parts are only valid until this returns
+        */
         virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
 
         // data filename
         boost::filesystem::path data_file;
+
+    private:
+        /* parts of the current line
+         * the strings are reused for the next lines to keep their capacity
+        */
+        vector<std::string> m_parts;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
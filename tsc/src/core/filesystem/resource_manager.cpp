@@ -179,6 +179,16 @@ fs::path cResource_Manager::Get_User_GameConsole_Logfile()
     return m_paths.user_cache_dir / path_to_utf8("gameconsole.log");
 }
 
+fs::path cResource_Manager::Get_User_Editor_Catalog_File()
+{
+    return m_paths.user_cache_dir / utf8_to_path("editor_items.cache");
+}
+
+fs::path cResource_Manager::Get_User_Level_Catalog_File()
+{
+    return m_paths.user_cache_dir / utf8_to_path("levels.cache");
+}
+
 fs::path cResource_Manager::Get_Game_Schema_Directory()
 {
     return m_paths.game_data_dir / utf8_to_path(GAME_SCHEMA_DIR);
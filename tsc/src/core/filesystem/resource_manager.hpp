@@ -109,6 +109,8 @@ namespace TSC {
         boost::filesystem::path Get_User_Pixmaps_Directory();
         boost::filesystem::path Get_User_CEGUI_Logfile();
         boost::filesystem::path Get_User_GameConsole_Logfile();
+        boost::filesystem::path Get_User_Editor_Catalog_File();
+        boost::filesystem::path Get_User_Level_Catalog_File();
         boost::filesystem::path Get_User_Scripting_Directory();
 
         // Get files from the various directories in the user’s data directory
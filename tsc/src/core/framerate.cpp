@@ -38,6 +38,9 @@ void cPerformance_Timer::Reset(void)
     frame_counter = 0;
     ms_counter = 0;
     ms = 0;
+    us_counter = 0;
+    total_frames = 0;
+    total_us = 0;
 }
 
 void cPerformance_Timer::Update(void)
@@ -50,6 +53,12 @@ void cPerformance_Timer::Update(void)
     ms_counter += new_ticks - pFramerate->m_perf_last_ticks;
     pFramerate->m_perf_last_ticks = new_ticks;
 
+    // add microseconds
+    uint64_t new_microticks = TSC_GetMicroTicks();
+    total_us += new_microticks - pFramerate->m_perf_last_microticks;
+    total_frames++;
+    pFramerate->m_perf_last_microticks = new_microticks;
+
     // counted 100 frames
     if (frame_counter >= 100) {
         ms = ms_counter;
@@ -58,6 +67,23 @@ void cPerformance_Timer::Update(void)
     }
 }
 
+void cPerformance_Timer::Add(uint64_t us)
+{
+    // count frame
+    frame_counter++;
+
+    us_counter += us;
+    total_us += us;
+    total_frames++;
+
+    // counted 100 frames
+    if (frame_counter >= 100) {
+        ms = static_cast<uint32_t>(us_counter / 1000);
+        frame_counter = 0;
+        us_counter = 0;
+    }
+}
+
 
 /* *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -75,10 +101,18 @@ cFramerate::cFramerate(void)
     m_max_elapsed_ticks = 100;
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
+    m_fixed_timestep = 0;
+    // two steps per speed factor frame
+    m_fixed_step_speed_factor = 0.5f;
+    m_fixed_step_ticks = 0.0f;
+    m_interpolation = 1.0f;
+    m_frame_speed_factor = m_speed_factor;
+    m_frame_start_microticks = 0;
     m_perf_last_ticks = 0;
+    m_perf_last_microticks = 0;
 
     // create performance timers
-    for (unsigned int i = 0; i < 24; i++) {
+    for (unsigned int i = 0; i < 26; i++) {
         m_perf_timer.push_back(new cPerformance_Timer());
     }
 }
@@ -171,6 +205,8 @@ void cFramerate::Reset(void)
     m_fps_average = 0;
     m_fps_average_framedelay = m_last_ticks;
     m_frames_counted = 0;
+    m_fixed_step_ticks = 0.0f;
+    m_interpolation = 1.0f;
 
     // reset performance timer
     for (Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr) {
@@ -178,16 +214,80 @@ void cFramerate::Reset(void)
     }
 }
 
+void cFramerate::Start_Perf_Measure(void)
+{
+    m_perf_last_ticks = TSC_GetTicks();
+    m_perf_last_microticks = TSC_GetMicroTicks();
+}
+
+void cFramerate::Start_Frame(void)
+{
+    m_frame_start_microticks = TSC_GetMicroTicks();
+}
+
+uint64_t cFramerate::Get_Frame_Time_Left(const unsigned int fps) const
+{
+    const uint64_t frame_us = 1000000 / fps;
+    const uint64_t elapsed_us = TSC_GetMicroTicks() - m_frame_start_microticks;
+
+    if (elapsed_us >= frame_us) {
+        return 0;
+    }
+
+    return frame_us - elapsed_us;
+}
+
 void cFramerate::Set_Max_Elapsed_Ticks(const uint32_t ticks)
 {
     m_max_elapsed_ticks = ticks;
 }
 
+void cFramerate::Set_Elapsed_Ticks(const uint32_t ticks)
+{
+    m_elapsed_ticks = ticks;
+
+    // minimum
+    if (m_elapsed_ticks == 0) {
+        m_elapsed_ticks = 1;
+    }
+
+    m_speed_factor = static_cast<float>(m_elapsed_ticks / (1000 / m_fps_target));
+}
+
 void cFramerate::Set_Fixed_Speedfacor(const float val)
 {
     m_force_speed_factor = val;
 }
 
+void cFramerate::Set_Fixed_Timestep(const bool enable)
+{
+    m_fixed_timestep = enable;
+    m_fixed_step_ticks = 0.0f;
+    m_interpolation = 1.0f;
+}
+
+unsigned int cFramerate::Begin_Fixed_Steps(void)
+{
+    const float ticks_per_step = (m_fixed_step_speed_factor * 1000.0f) / m_fps_target;
+
+    // m_elapsed_ticks is already limited to m_max_elapsed_ticks
+    m_fixed_step_ticks += static_cast<float>(m_elapsed_ticks);
+
+    unsigned int steps = static_cast<unsigned int>(m_fixed_step_ticks / ticks_per_step);
+    m_fixed_step_ticks -= steps * ticks_per_step;
+    m_interpolation = m_fixed_step_ticks / ticks_per_step;
+
+    m_frame_speed_factor = m_speed_factor;
+    m_speed_factor = m_fixed_step_speed_factor;
+
+    return steps;
+}
+
+void cFramerate::End_Fixed_Steps(void)
+{
+    m_speed_factor = m_frame_speed_factor;
+}
+
 /* *** *** *** *** *** *** *** helper functions *** *** *** *** *** *** *** *** *** *** */
 
 void Correct_Frame_Time(const unsigned int fps)
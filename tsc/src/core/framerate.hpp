@@ -34,6 +34,10 @@ namespace TSC {
 
         // Update and set new framerate ticks
         void Update(void);
+        /* Count a frame with the given microseconds
+         * for time which is not measured as one section
+        */
+        void Add(uint64_t us);
 
         // current frame counter
         uint32_t frame_counter;
@@ -41,6 +45,13 @@ namespace TSC {
         uint32_t ms_counter;
         // milliseconds per 100 frames
         uint32_t ms;
+        // current microseconds per frames counted by Add()
+        uint64_t us_counter;
+
+        // frames counted since the last reset
+        uint32_t total_frames;
+        // microseconds counted since the last reset
+        uint64_t total_us;
     };
 
     /* *** *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** */
@@ -61,14 +72,53 @@ namespace TSC {
         // reset speed factor and worst/best fps statistic
         void Reset(void);
 
+        // Start a new section for the performance timers
+        void Start_Perf_Measure(void);
+
+        // Set the frame start to now
+        void Start_Frame(void);
+        // Return the microseconds left until the frame at the given fps is over
+        uint64_t Get_Frame_Time_Left(const unsigned int fps) const;
+
         // set maximum allowed elapsed ticks
         void Set_Max_Elapsed_Ticks(const uint32_t ticks);
+        /* Use the given elapsed ticks for the current frame
+         * the speed factor is calculated from them as in Update()
+        */
+        void Set_Elapsed_Ticks(const uint32_t ticks);
 
         /* Set the given fixed speed factor
          * if value is 0 no fixed speed factor will be used
         */
         void Set_Fixed_Speedfacor(const float val);
 
+        /* Enable or disable the fixed timestep mode
+         * game logic is then updated in steps of the constant m_fixed_step_speed_factor
+         * instead of once per frame with the measured speed factor
+         * and drawing interpolates between the last two steps
+        */
+        void Set_Fixed_Timestep(const bool enable);
+        /* Add the elapsed frame time and return the number of fixed steps to update now
+         * sets the speed factor to the fixed step value until End_Fixed_Steps() is called
+         * and m_interpolation to the fraction of a step left for the next frame
+        */
+        unsigned int Begin_Fixed_Steps(void);
+        // Restore the measured frame speed factor
+        void End_Fixed_Steps(void);
+
+        // fixed timestep mode enabled
+        bool m_fixed_timestep;
+        // speed factor of a fixed step
+        float m_fixed_step_speed_factor;
+        // elapsed ticks not yet used by a fixed step
+        float m_fixed_step_ticks;
+        /* fraction of a fixed step passed since the last step
+         * used to interpolate drawing positions
+        */
+        float m_interpolation;
+        // measured speed factor of this frame while fixed steps run
+        float m_frame_speed_factor;
+
         // target fps for speed factor calculations
         float m_fps_target;
         // current fps
@@ -100,9 +150,14 @@ namespace TSC {
         // fixed speed factor value
         float m_force_speed_factor;
 
+        // microseconds when the frame started after waiting for the fps limit
+        uint64_t m_frame_start_microticks;
+
         // ## performance values ##
         // ticks since last section
         uint32_t m_perf_last_ticks;
+        // microseconds since last section
+        uint64_t m_perf_last_microticks;
 
         typedef vector<cPerformance_Timer*> Performance_Timer_List;
         Performance_Timer_List m_perf_timer;
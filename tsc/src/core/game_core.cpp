@@ -19,6 +19,7 @@
 #include "../input/keyboard.hpp"
 #include "../input/mouse.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_recorder.hpp"
 #include "../level/level_settings.hpp"
 #include "sprite_manager.hpp"
 #include "../level/level_editor.hpp"
@@ -96,6 +97,13 @@ uint32_t TSC_GetTicks()
     return static_cast<uint32_t>(result.count()); // heaven knows what type duration::count() actually returns... Let’s hope this works.
 }
 
+uint64_t TSC_GetMicroTicks()
+{
+    std::chrono::steady_clock::time_point time_now = std::chrono::steady_clock::now();
+    std::chrono::microseconds result = std::chrono::duration_cast<std::chrono::microseconds>(time_now - s_initial_time);
+    return static_cast<uint64_t>(result.count());
+}
+
 void Handle_Game_Events(void)
 {
     // if game action is set
@@ -155,6 +163,12 @@ void Handle_Game_Events(void)
             }
 
             Handle_Generic_Game_Events(current_game_action_data_start);
+
+            // the screen is faded out and a pause is not visible
+            if (current_game_mode == MODE_LEVEL && pActive_Level->m_mruby) {
+                pActive_Level->m_mruby->Get_GC_Scheduler().Full_Collect();
+            }
+
             Leave_Game_Mode(new_mode);
             Handle_Generic_Game_Events(current_game_action_data_middle);
             Enter_Game_Mode(new_mode);
@@ -337,7 +351,8 @@ void Enter_Game_Mode(const GameMode new_mode)
 
 void Clear_Input_Events(void)
 {
-    while (pVideo->PollEvent(input_event)) {
+    // recorded as well so replaying discards the same events
+    while (pInput_Recorder->Poll_Event(input_event)) {
         // todo : keep Windowmanager quit events ?
         // ignore all events
     }
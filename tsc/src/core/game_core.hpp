@@ -78,6 +78,8 @@ namespace TSC {
 
     /// Return the number of milliseconds since the start of TSC.
     uint32_t TSC_GetTicks();
+    /// Return the number of microseconds since the start of TSC.
+    uint64_t TSC_GetMicroTicks();
 
 // Handle game events
     void Handle_Game_Events(void);
@@ -59,6 +59,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <atomic>
 #include <time.h>
 #include <math.h>
 #include <functional>
@@ -67,9 +68,11 @@
 #include <stdexcept>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <iomanip>
 #include <stack>
+#include <memory>
 
 // TSC build configuration header
 #include "config.hpp"
@@ -139,6 +142,8 @@
 #include <mruby/variable.h>
 #include <mruby/proc.h>
 #include <mruby/range.h>
+#include <mruby/irep.h>
+#include <mruby/dump.h>
 
 #ifndef PNG_COLOR_TYPE_RGBA
 #define PNG_COLOR_TYPE_RGBA PNG_COLOR_TYPE_RGB_ALPHA
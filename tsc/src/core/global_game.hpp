@@ -380,6 +380,10 @@ namespace TSC {
         PERF_UPDATE_LATE_LEVEL = 22,
         PERF_UPDATE_LEVEL_COLLISIONS = 5,
         PERF_UPDATE_CAMERA = 6,
+        // mruby callbacks, also counted in the sections they ran in
+        PERF_UPDATE_SCRIPTS = 24,
+        // mruby garbage collection in the idle time of the frame
+        PERF_UPDATE_SCRIPT_GC = 25,
         // update overworld
         PERF_UPDATE_OVERWORLD = 17,
         // update menu
@@ -408,6 +412,7 @@ namespace TSC {
 
     /* *** Classes *** */
 
+    class cBall;
     class cCamera;
     class cCircle_Request;
     class cEditor_Object_Settings_Item;
@@ -416,6 +421,7 @@ namespace TSC {
     class cImage_Settings_Data;
     class cLayer_Line_Point_Start;
     class cLevel;
+    class cLevel_Snapshot;
     class cLine_collision;
     class cLine_Request;
     class cLevel_Settings;
@@ -436,6 +442,7 @@ namespace TSC {
     class cSprite_Manager;
     class cSurface_Request;
     class cSprite;
+    class cSprite_Pool_Base;
     class cBackground_Manager;
     class cWorld_Sprite_Manager;
     class Color;
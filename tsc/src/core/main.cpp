@@ -45,12 +45,20 @@
 #include "../gui/generic.hpp"
 #include "../gui/game_console.hpp"
 #include "../gui/debug_window.hpp"
+#include "../core/benchmark.hpp"
+#include "../input/input_recorder.hpp"
+#include "../core/startup_timeline.hpp"
+
+#include <libxml/parser.h>
 
 using namespace std;
 
 // TSC namespace is set later to exclude main() from it
 using namespace TSC;
 
+// stages of Init_Game() up to the first frame
+static cStartup_Timeline startup_timeline;
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 int main(int argc, char** argv)
@@ -95,6 +103,11 @@ int main(int argc, char** argv)
 
     // convert arguments to a vector string
     vector<std::string> arguments(argv, argv + argc);
+    // headless benchmark run if ticks are set
+    cBenchmark benchmark;
+    // input log to record or replay
+    boost::filesystem::path record_file;
+    boost::filesystem::path replay_file;
 
     if (argc >= 2) {
         for (unsigned int i = 1; i < arguments.size(); i++) {
@@ -107,6 +120,15 @@ int main(int argc, char** argv)
                 cout << "-d, --debug\tEnable debug modes with the options : game performance" << endl;
                 cout << "-l, --level\tLoad the given level" << endl;
                 cout << "-w, --world\tLoad the given world" << endl;
+                cout << "--benchmark TICKS\tRun the level given with --level for TICKS ticks without drawing and print the timing" << endl;
+                cout << "--input FILE\tReplay the player input from the given input log in the benchmark" << endl;
+                cout << "--benchmark-result FILE\tCompare the benchmark timing with the given file and save it there" << endl;
+                cout << "--benchmark-fire ENEMIES\tLet the player shoot fireballs every tick of the benchmark through ENEMIES furballs" << endl;
+                cout << "--record FILE\tRecord the input into the given input log" << endl;
+                cout << "--replay FILE\tReplay the input from the given input log" << endl;
+                cout << "--build-settings-index DIR FILE\tSave the resolved image settings of the pixmaps directory DIR into the index FILE and exit" << endl;
+                cout << "--benchmark-parser DIR\tParse all settings, image set and text files in DIR, print the timing and exit" << endl;
+                cout << "--startup-profile\tPrint the time of each startup stage after the first frame" << endl;
                 return EXIT_SUCCESS;
             }
             // version
@@ -150,12 +172,84 @@ int main(int argc, char** argv)
             }
             // level loading is handled later
             else if (arguments[i] == "--level" || arguments[i] == "-l") {
-                // skip
+                if (i + 1 < arguments.size()) {
+                    benchmark.m_level_name = arguments[i + 1];
+                }
             }
             // world loading is handled later
             else if (arguments[1] == "--world" || arguments[1] == "-w") {
                 // skip
             }
+            // benchmark options
+            else if (arguments[i] == "--benchmark" || arguments[i] == "--input" || arguments[i] == "--benchmark-result" || arguments[i] == "--benchmark-fire") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                if (arguments[i] == "--benchmark") {
+                    benchmark.m_ticks = string_to_int(arguments[i + 1]);
+                }
+                else if (arguments[i] == "--input") {
+                    benchmark.m_input_file = utf8_to_path(arguments[i + 1]);
+                }
+                else if (arguments[i] == "--benchmark-fire") {
+                    benchmark.m_fire = 1;
+                    benchmark.m_fire_enemies = string_to_int(arguments[i + 1]);
+                }
+                else {
+                    benchmark.m_result_file = utf8_to_path(arguments[i + 1]);
+                }
+
+                i++;
+            }
+            // input recording
+            else if (arguments[i] == "--record" || arguments[i] == "--replay") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                if (arguments[i] == "--record") {
+                    record_file = utf8_to_path(arguments[i + 1]);
+                }
+                else {
+                    replay_file = utf8_to_path(arguments[i + 1]);
+                }
+
+                i++;
+            }
+            // image settings index
+            else if (arguments[i] == "--build-settings-index") {
+                // no value
+                if (i + 2 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a directory and a file" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                // only needs the settings files
+                if (!cImage_Settings_Parser::Save_Index(utf8_to_path(arguments[i + 1]), utf8_to_path(arguments[i + 2]))) {
+                    return EXIT_FAILURE;
+                }
+
+                return EXIT_SUCCESS;
+            }
+            // startup timeline
+            else if (arguments[i] == "--startup-profile") {
+                startup_timeline.m_print = 1;
+            }
+            // data file parser benchmark
+            else if (arguments[i] == "--benchmark-parser") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a directory" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                return cBenchmark::Run_Parser(utf8_to_path(arguments[i + 1]));
+            }
             // unknown argument
             else if (arguments[i].substr(0, 1) == "-") {
                 cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
@@ -170,6 +264,32 @@ int main(int argc, char** argv)
 
         // initialize everything
         Init_Game();
+        // startup ends with the first frame
+        bool first_frame = 1;
+
+        // headless benchmark
+        if (benchmark.m_ticks > 0) {
+            if (benchmark.m_level_name.empty()) {
+                cerr << "--benchmark requires a level given with --level" << endl;
+                Exit_Game();
+                return EXIT_FAILURE;
+            }
+
+            int result = benchmark.Run();
+            Exit_Game();
+            return result;
+        }
+
+        // input log
+        if (!replay_file.empty()) {
+            if (!pInput_Recorder->Start_Replay(replay_file)) {
+                Exit_Game();
+                return EXIT_FAILURE;
+            }
+        }
+        else if (!record_file.empty()) {
+            pInput_Recorder->Start_Recording(record_file);
+        }
 
         // command line level entering
         if (argc > 2 && (arguments[1] == "--level" || arguments[1] == "-l") && !arguments[2].empty()) {
@@ -202,6 +322,8 @@ int main(int argc, char** argv)
                 Update_Game();
                 // draw
                 Draw_Game();
+                // script garbage in the idle time
+                Collect_Script_Garbage();
 
                 // render
 #ifdef TSC_RENDER_THREAD_TEST
@@ -212,6 +334,15 @@ int main(int argc, char** argv)
 
                 // update speedfactor
                 pFramerate->Update();
+
+                if (first_frame) {
+                    first_frame = 0;
+                    startup_timeline.End_Stage();
+
+                    if (startup_timeline.m_print) {
+                        startup_timeline.Print();
+                    }
+                }
             }
 #ifndef _DEBUG
         }
@@ -244,10 +375,13 @@ namespace TSC {
 
 void Init_Game(void)
 {
+    startup_timeline.Reset();
+
     // init random number generator
     srand(static_cast<unsigned int>(time(NULL)));
 
     // Init Stage 1 - core classes
+    startup_timeline.Stage("core");
     debug_print("Initializing resource manager and core classes\n");
     pResource_Manager = new cResource_Manager();
     pVideo = new cVideo();
@@ -258,10 +392,14 @@ void Init_Game(void)
     pImage_Manager = new cImage_Manager();
     pSound_Manager = new cSound_Manager();
     pSettingsParser = new cImage_Settings_Parser();
+    // prebuilt image settings
+    startup_timeline.Stage("settings_index");
+    cImage_Settings_Parser::Load_Index(pResource_Manager->Get_Game_Pixmaps_Directory(), pResource_Manager->Get_Game_Pixmaps_Directory() / utf8_to_path("settings.index"));
 
     // Init Stage 2 - set preferences and init audio and the video screen
 
     // load user data
+    startup_timeline.Stage("preferences");
     pPreferences = cPreferences::Load_From_File(pResource_Manager->Get_Preferences_File());
     debug_print("Configuration file is '%s'.\n", path_to_utf8(pPreferences->m_config_filename).c_str());
 
@@ -271,15 +409,27 @@ void Init_Game(void)
     I18N_Init();
     // init user dir directory
     pResource_Manager->Init_User_Directory();
+
+    /* campaigns only need the campaign directories
+     * libxml has to be initialized before it is used from more threads
+    */
+    debug_print("Loading campaigns\n");
+    xmlInitParser();
+    startup_timeline.Start_Task("campaigns", []() {
+        pCampaign_Manager = new cCampaign_Manager();
+    });
+
     // framerate init
     pFramerate->Init();
     // audio init
+    startup_timeline.Stage("audio");
     pAudio->Init();
     // video init
+    startup_timeline.Stage("video");
     pVideo->Init_Video();
 
-    debug_print("Loading campaigns\n");
-    pCampaign_Manager = new cCampaign_Manager();
+    startup_timeline.Stage("level_player");
+    startup_timeline.Wait_Task("campaigns");
 
     debug_print("Setting up level player\n");
     pLevel_Player = new cLevel_Player(NULL);
@@ -288,6 +438,7 @@ void Init_Game(void)
     pActive_Player = pLevel_Player;
 
     debug_print("Loading levels\n");
+    startup_timeline.Stage("levels");
     pLevel_Manager = new cLevel_Manager();
     // set the first animation manager available
     pActive_Animation_Manager = pActive_Level->m_animation_manager;
@@ -299,11 +450,13 @@ void Init_Game(void)
     pPreferences->Apply();
 
     // draw generic loading screen
+    startup_timeline.Stage("image_cache");
     Loading_Screen_Init();
     // initialize image cache
     pVideo->Init_Image_Cache(0);
 
     // Init Stage 3 - game classes
+    startup_timeline.Stage("hud_and_editors");
     gp_hud = new cHud();
     pLevel_Player->Init();
 
@@ -318,23 +471,37 @@ void Init_Game(void)
     pMouseCursor = new cMouseCursor(pActive_Level->m_sprite_manager);
     pKeyboard = new cKeyboard();
     pJoystick = new cJoystick();
+    pInput_Recorder = new cInput_Recorder();
     pLevel_Manager->Init();
     // note : set any sprite manager as cOverworld_Manager::Load sets it again
+    startup_timeline.Stage("overworlds");
     pOverworld_Player = new cOverworld_Player(pActive_Level->m_sprite_manager, NULL);
     pOverworld_Manager = new cOverworld_Manager(pActive_Level->m_sprite_manager);
     gp_debug_window = new cDebug_Window(pActive_Level->m_sprite_manager);
     // set default overworld active
     pOverworld_Player->Set_Overworld(pOverworld_Manager->Get("World 1"));
     pOverworld_Manager->Set_Active("World 1");
+    startup_timeline.Stage("menu");
     pMenuCore = new cMenuCore();
     pSavegame = new cSavegame();
 
-    // cache
+    /* cache
+     * the sounds are decoded next to the images as nothing else uses the sound manager now
+     * the images need the main thread for the OpenGL context
+    */
     debug_print("Preloading images and sounds...\n");
+    startup_timeline.Start_Task("preload_sounds", []() {
+        Preload_Sounds(0);
+    });
+    startup_timeline.Stage("preload_images");
     Preload_Images(1);
-    Preload_Sounds(1);
+    startup_timeline.Stage("wait_sounds");
+    startup_timeline.Wait_Task("preload_sounds");
     debug_print("Done preloading images and sounds.\n");
     Loading_Screen_Exit();
+
+    // until the first frame is drawn
+    startup_timeline.Stage("first_frame");
 }
 
 // Note: This function must not throw exceptions! It is called in main()'s
@@ -403,6 +570,12 @@ void Exit_Game(void)
         pMouseCursor = NULL;
     }
 
+    // saves the recording
+    if (pInput_Recorder) {
+        delete pInput_Recorder;
+        pInput_Recorder = NULL;
+    }
+
     if (pJoystick) {
         delete pJoystick;
         pJoystick = NULL;
@@ -463,6 +636,8 @@ void Exit_Game(void)
         pSettingsParser = NULL;
     }
 
+    cImage_Settings_Parser::Clear_Cache();
+
     if (pResource_Manager) {
         delete pResource_Manager;
         pResource_Manager = NULL;
@@ -583,6 +758,8 @@ void Update_Game(void)
         Correct_Frame_Time(pPreferences->m_video_fps_limit);
     }
 
+    pFramerate->Start_Frame();
+
     if (Game_Action != GA_NONE) {
         pVideo->Render_Finish();
     }
@@ -591,9 +768,12 @@ void Update_Game(void)
     Handle_Game_Events();
 
     // ## input
+    // records or replays the input of this tick
+    pInput_Recorder->Next_Tick();
+
     // Actually `input_event' is a global variable that is also queried elsewhere
     // in the code (uaaah, poor design).
-    while (pVideo->PollEvent(input_event)) {
+    while (pInput_Recorder->Poll_Event(input_event)) {
         // handle
         Handle_Input_Global(input_event);
     }
@@ -604,8 +784,33 @@ void Update_Game(void)
     pAudio->Resume_Music();
     pAudio->Update();
 
+    // ## update
+    if (pFramerate->m_fixed_timestep) {
+        const unsigned int steps = pFramerate->Begin_Fixed_Steps();
+
+        for (unsigned int i = 0; i < steps; i++) {
+            Update_Game_Step();
+
+            // game action or mode change is handled first on the next frame
+            if (game_exit || Game_Action != GA_NONE) {
+                break;
+            }
+        }
+
+        pFramerate->End_Fixed_Steps();
+    }
+    else {
+        Update_Game_Step();
+    }
+
+    // ## debug window
+    gp_debug_window->Update();
+}
+
+void Update_Game_Step(void)
+{
     // performance measuring
-    pFramerate->m_perf_last_ticks = TSC_GetTicks();
+    pFramerate->Start_Perf_Measure();
 
     // ## hud
     gp_hud->Update();
@@ -613,9 +818,6 @@ void Update_Game(void)
     // ## game console
     gp_game_console->Update();
 
-    // ## debug window
-    gp_debug_window->Update();
-
     // ## update
     if (Game_Mode == MODE_LEVEL) {
         pLevel_Manager->Update();
@@ -645,7 +847,7 @@ void Draw_Game(void)
     }
 
     // performance measuring
-    pFramerate->m_perf_last_ticks = TSC_GetTicks();
+    pFramerate->Start_Perf_Measure();
 
     if (Game_Mode == MODE_LEVEL) {
         pLevel_Manager->Draw();
@@ -670,6 +872,27 @@ void Draw_Game(void)
     pFramerate->m_perf_timer[PERF_DRAW_MOUSE]->Update();
 }
 
+void Collect_Script_Garbage(void)
+{
+    if (game_exit || Game_Mode != MODE_LEVEL || !pActive_Level->m_mruby) {
+        return;
+    }
+
+    // without a limit the deadline of 60 fps is used
+    const unsigned int fps = pPreferences->m_video_fps_limit ? pPreferences->m_video_fps_limit : 60;
+    uint64_t time_left = pFramerate->Get_Frame_Time_Left(fps);
+
+    // leave the time the last frame needed to render
+    if (time_left > pVideo->m_render_us) {
+        time_left -= pVideo->m_render_us;
+    }
+    else {
+        time_left = 0;
+    }
+
+    pActive_Level->m_mruby->Get_GC_Scheduler().Update(time_left);
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
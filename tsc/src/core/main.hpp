@@ -39,11 +39,23 @@ namespace TSC {
     */
     void Update_Game(void);
 
+    /* Update the game logic of the current game mode by one step
+     * Called once per frame from Update_Game or in the fixed timestep
+     * mode as often as needed to catch up with the elapsed time.
+    */
+    void Update_Game_Step(void);
+
     /* Draw current game state
      * Should be called continuously from Game Loop.
     */
     void Draw_Game(void);
 
+    /* Run the script garbage collection of the active level
+     * in the time left until the frame deadline
+     * Called once per frame after drawing.
+    */
+    void Collect_Script_Garbage(void);
+
     /* This constant holds the entire string shown at the
      * credits screen. It is implemented in a file generated
      * during the build process (from credits.cpp.in). */
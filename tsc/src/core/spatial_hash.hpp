@@ -0,0 +1,142 @@
+/***************************************************************************
+ * spatial_hash.hpp  -  Generic uniform grid for rectangle queries
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPATIAL_HASH_HPP
+#define TSC_SPATIAL_HASH_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cSpatial_Hash *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Sparse uniform grid. Every item is registered in all cells
+     * its rectangle touches, so a query only has to look at the
+     * cells around the requested area instead of every item.
+     * Only empty cells are stored implicitly, which keeps huge
+     * and mostly empty worlds cheap.
+     *
+     * Query results are candidates: the caller still has to do
+     * the exact intersection test.
+    */
+    template<class T> class cSpatial_Hash {
+    public:
+        cSpatial_Hash(float cell_size = 128.0f)
+            : m_cell_size(cell_size) {};
+
+        // Remove all items
+        void Clear(void)
+        {
+            m_cells.clear();
+        }
+
+        // Return true if no items are registered
+        bool Empty(void) const
+        {
+            return m_cells.empty();
+        }
+
+        // Register the item in all cells touched by the given rect
+        void Insert(const GL_rect& rect, const T& item)
+        {
+            int x1, y1, x2, y2;
+            Get_Cell_Range(rect, x1, y1, x2, y2);
+
+            for (int cx = x1; cx <= x2; cx++) {
+                for (int cy = y1; cy <= y2; cy++) {
+                    m_cells[Get_Cell_Key(cx, cy)].push_back(item);
+                }
+            }
+        }
+
+        /* Remove the item from all cells touched by the given rect
+         * the rect must be the one it was inserted with
+        */
+        void Remove(const GL_rect& rect, const T& item)
+        {
+            int x1, y1, x2, y2;
+            Get_Cell_Range(rect, x1, y1, x2, y2);
+
+            for (int cx = x1; cx <= x2; cx++) {
+                for (int cy = y1; cy <= y2; cy++) {
+                    typename CellMap::iterator cell_itr = m_cells.find(Get_Cell_Key(cx, cy));
+
+                    if (cell_itr == m_cells.end()) {
+                        continue;
+                    }
+
+                    vector<T>& cell = cell_itr->second;
+                    typename vector<T>::iterator itr = std::find(cell.begin(), cell.end(), item);
+
+                    if (itr != cell.end()) {
+                        cell.erase(itr);
+                    }
+
+                    if (cell.empty()) {
+                        m_cells.erase(cell_itr);
+                    }
+                }
+            }
+        }
+
+        /* Append all items registered in the cells touched by the given rect
+         * the result is sorted and contains every item only once
+        */
+        void Query(const GL_rect& rect, vector<T>& result) const
+        {
+            int x1, y1, x2, y2;
+            Get_Cell_Range(rect, x1, y1, x2, y2);
+
+            for (int cx = x1; cx <= x2; cx++) {
+                for (int cy = y1; cy <= y2; cy++) {
+                    typename CellMap::const_iterator cell_itr = m_cells.find(Get_Cell_Key(cx, cy));
+
+                    if (cell_itr != m_cells.end()) {
+                        result.insert(result.end(), cell_itr->second.begin(), cell_itr->second.end());
+                    }
+                }
+            }
+
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+        }
+
+    private:
+        typedef std::unordered_map<uint64_t, vector<T> > CellMap;
+
+        // Cell coordinates touched by the rect, borders included as GL_rect::Intersects does
+        void Get_Cell_Range(const GL_rect& rect, int& x1, int& y1, int& x2, int& y2) const
+        {
+            x1 = static_cast<int>(floor(rect.m_x / m_cell_size));
+            y1 = static_cast<int>(floor(rect.m_y / m_cell_size));
+            x2 = static_cast<int>(floor((rect.m_x + rect.m_w) / m_cell_size));
+            y2 = static_cast<int>(floor((rect.m_y + rect.m_h) / m_cell_size));
+        }
+
+        static uint64_t Get_Cell_Key(int cx, int cy)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+        }
+
+        float m_cell_size;
+        CellMap m_cells;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -20,6 +20,7 @@
 #include "../input/mouse.hpp"
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
+#include "../objects/path.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -28,6 +29,8 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+const cSprite_List cSprite_Manager::m_empty_bucket;
+
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
     : cObject_Manager<cSprite>()
 {
@@ -36,6 +39,13 @@ cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsign
     m_max_uid_mark = 1; // UID 0 is reserved for the player
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
+    m_editor_index_valid = 0;
+    m_collision_awake_count = 0;
+    m_collision_sleeping_count = 0;
+    m_update_region_cell_x = 0;
+    m_update_region_cell_y = 0;
+    m_update_region_valid = 0;
+    m_path_index_valid = 0;
 }
 
 cSprite_Manager::~cSprite_Manager(void)
@@ -79,26 +89,102 @@ void cSprite_Manager::Add(cSprite* sprite)
     }
 
     // Check if an destroyed object can be replaced
-    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        // get object pointer
-        cSprite* obj = (*itr);
+    while (!m_destroyed_sprites.empty()) {
+        cSprite* obj = m_destroyed_sprites.back();
+        m_destroyed_sprites.pop_back();
 
-        // if destroy is set
-        if (obj->m_auto_destroy) {
-            // set new object
-            *itr = sprite;
+        // recently spawned sprites are mostly near the end
+        cSprite_List::reverse_iterator itr = std::find(objects.rbegin(), objects.rend(), obj);
 
-            // Release old sprite’s UID by putting it back into the UID pool
-            m_uid_pool.insert(obj->m_uid);
+        // deleted or already replaced
+        if (itr == objects.rend() || !obj->m_auto_destroy) {
+            continue;
+        }
 
-            // delete old
-            delete obj;
+        // set new object
+        *itr = sprite;
 
-            return;
+        // Release old sprite’s UID by putting it back into the UID pool
+        m_uid_pool.insert(obj->m_uid);
+
+        // delete old
+        Remove_From_Editor_Index(obj);
+        Remove_From_Buckets(obj);
+        cSprite_Pool_Base::Release_Or_Delete(obj);
+
+        Add_To_Buckets(sprite);
+
+        if (m_editor_index_valid) {
+            m_editor_index.Insert(sprite->m_start_rect, sprite);
+            m_editor_index_rects[sprite] = sprite->m_start_rect;
         }
+
+        return;
     }
 
     cObject_Manager<cSprite>::Add(sprite);
+    Add_To_Buckets(sprite);
+
+    if (m_editor_index_valid) {
+        m_editor_index.Insert(sprite->m_start_rect, sprite);
+        m_editor_index_rects[sprite] = sprite->m_start_rect;
+    }
+
+    // destroyed before it was added
+    if (sprite->m_auto_destroy) {
+        m_destroyed_sprites.push_back(sprite);
+    }
+}
+
+bool cSprite_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    if (array_num >= objects.size()) {
+        return 0;
+    }
+
+    return Delete(objects[array_num], delete_data);
+}
+
+bool cSprite_Manager::Delete(cSprite* sprite, bool delete_data /* = 1 */)
+{
+    Remove_From_Editor_Index(sprite);
+
+    if (!sprite) {
+        return 0;
+    }
+
+    Remove_From_Buckets(sprite);
+
+    if (sprite->m_auto_destroy) {
+        cSprite_List::iterator itr = std::find(m_destroyed_sprites.begin(), m_destroyed_sprites.end(), sprite);
+
+        if (itr != m_destroyed_sprites.end()) {
+            *itr = m_destroyed_sprites.back();
+            m_destroyed_sprites.pop_back();
+        }
+    }
+
+    cObject_Manager<cSprite>::Delete(sprite, 0);
+
+    if (delete_data) {
+        // a pooled sprite is not deleted so destroy it like the destructor would
+        if (sprite->m_pool && !sprite->m_auto_destroy) {
+            sprite->Destroy();
+        }
+
+        cSprite_Pool_Base::Release_Or_Delete(sprite);
+    }
+
+    return 1;
+}
+
+void cSprite_Manager::Sprite_Destroyed(cSprite* sprite)
+{
+    if (!Is_In_Buckets(sprite)) {
+        return;
+    }
+
+    m_destroyed_sprites.push_back(sprite);
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -227,6 +313,11 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
             cSprite* obj = (*itr);
 
             obj->Destroy(); // Marks for autodestroy in cSprite_Manager::Add()
+
+            // the buckets only hold destroyed sprites until they are replaced or deleted
+            if (obj->m_auto_destroy) {
+                Remove_From_Buckets(obj);
+            }
         }
     }
     // instant
@@ -248,6 +339,13 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
         cObject_Manager<cSprite>::Delete_All();
     }
 
+    Clear_Editor_Index();
+
+    if (!delayed) {
+        Clear_Buckets();
+        m_destroyed_sprites.clear();
+    }
+
     // Empty the UID pool, we have no sprites anymore
     m_uid_pool.clear();
 
@@ -259,12 +357,13 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
 cSprite* cSprite_Manager::Get_First(const SpriteType type) const
 {
     cSprite* first = NULL;
+    const cSprite_List& bucket = Get_Objects_by_Type(type);
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = bucket.begin(); itr != bucket.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
-        if (obj->m_type == type && (!first || obj->m_pos_z < first->m_pos_z)) {
+        if (!first || obj->m_pos_z < first->m_pos_z) {
             first = obj;
         }
     }
@@ -276,12 +375,13 @@ cSprite* cSprite_Manager::Get_First(const SpriteType type) const
 cSprite* cSprite_Manager::Get_Last(const SpriteType type) const
 {
     cSprite* last = NULL;
+    const cSprite_List& bucket = Get_Objects_by_Type(type);
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = bucket.begin(); itr != bucket.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
-        if (obj->m_type == type && (!last || obj->m_pos_z > last->m_pos_z)) {
+        if (!last || obj->m_pos_z > last->m_pos_z) {
             last = obj;
         }
     }
@@ -401,8 +501,283 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
     }
 }
 
+void cSprite_Manager::Get_Editor_Objects(cSprite_List& editor_objects, const GL_rect& rect, bool with_player /* = 0 */)
+{
+    // the start rects follow the sprites while playing
+    if (!editor_enabled) {
+        editor_objects.insert(editor_objects.end(), objects.begin(), objects.end());
+    }
+    else {
+        if (!m_editor_index_valid) {
+            Build_Editor_Index();
+        }
+
+        // candidates
+        m_editor_index.Query(rect, editor_objects);
+    }
+
+    for (cSprite_List::iterator itr = editor_objects.begin(); itr != editor_objects.end();) {
+        if (!rect.Intersects((*itr)->m_start_rect)) {
+            itr = editor_objects.erase(itr);
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    if (with_player && rect.Intersects(pActive_Player->m_start_rect)) {
+        editor_objects.push_back(pActive_Player);
+    }
+
+    std::sort(editor_objects.begin(), editor_objects.end(), editor_zpos_sort());
+}
+
+void cSprite_Manager::Update_Editor_Index(cSprite* sprite)
+{
+    EditorIndexRectMap::iterator itr = m_editor_index_rects.find(sprite);
+
+    // not indexed
+    if (itr == m_editor_index_rects.end()) {
+        return;
+    }
+
+    // unchanged
+    if (itr->second == sprite->m_start_rect) {
+        return;
+    }
+
+    m_editor_index.Remove(itr->second, sprite);
+    m_editor_index.Insert(sprite->m_start_rect, sprite);
+    itr->second = sprite->m_start_rect;
+}
+
+void cSprite_Manager::Clear_Editor_Index(void)
+{
+    m_editor_index.Clear();
+    m_editor_index_rects.clear();
+    m_editor_index_valid = 0;
+}
+
+void cSprite_Manager::Build_Editor_Index(void)
+{
+    Clear_Editor_Index();
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        m_editor_index.Insert(obj->m_start_rect, obj);
+        m_editor_index_rects[obj] = obj->m_start_rect;
+    }
+
+    m_editor_index_valid = 1;
+}
+
+void cSprite_Manager::Remove_From_Editor_Index(cSprite* sprite)
+{
+    EditorIndexRectMap::iterator itr = m_editor_index_rects.find(sprite);
+
+    if (itr == m_editor_index_rects.end()) {
+        return;
+    }
+
+    m_editor_index.Remove(itr->second, sprite);
+    m_editor_index_rects.erase(itr);
+}
+
+void cSprite_Manager::Update_Sprite_Buckets(cSprite* sprite)
+{
+    if (!Is_In_Buckets(sprite)) {
+        return;
+    }
+
+    // unchanged
+    if (sprite->m_bucket_type == sprite->m_type && sprite->m_bucket_array == sprite->m_sprite_array) {
+        return;
+    }
+
+    Remove_From_Buckets(sprite);
+    Add_To_Buckets(sprite);
+}
+
+cSprite* cSprite_Manager::Get_Path_by_Identifier(const std::string& identifier)
+{
+    if (identifier.empty()) {
+        return NULL;
+    }
+
+    // a path could have been destroyed since the index was built
+    for (unsigned int i = 0; i < 2; i++) {
+        if (!m_path_index_valid) {
+            m_path_index.clear();
+
+            const cSprite_List& paths = Get_Objects_by_Type(TYPE_PATH);
+
+            for (cSprite_List::const_iterator itr = paths.begin(); itr != paths.end(); ++itr) {
+                cPath* path = static_cast<cPath*>(*itr);
+
+                if (path->m_auto_destroy || path->m_identifier.empty()) {
+                    continue;
+                }
+
+                // the first path keeps the identifier
+                m_path_index.insert(PathIndexMap::value_type(path->m_identifier, path));
+            }
+
+            m_path_index_valid = 1;
+        }
+
+        PathIndexMap::const_iterator itr = m_path_index.find(identifier);
+
+        if (itr == m_path_index.end()) {
+            return NULL;
+        }
+
+        if (!itr->second->m_auto_destroy) {
+            return itr->second;
+        }
+
+        m_path_index_valid = 0;
+    }
+
+    return NULL;
+}
+
+void cSprite_Manager::Add_To_Buckets(cSprite* sprite)
+{
+    const unsigned int type = sprite->m_type;
+    const unsigned int sprite_array = sprite->m_sprite_array;
+
+    if (type >= m_type_buckets.size()) {
+        m_type_buckets.resize(type + 1);
+    }
+    if (sprite_array >= m_array_buckets.size()) {
+        m_array_buckets.resize(sprite_array + 1);
+    }
+
+    sprite->m_bucket_type = sprite->m_type;
+    sprite->m_type_bucket_pos = m_type_buckets[type].size();
+    m_type_buckets[type].push_back(sprite);
+
+    sprite->m_bucket_array = sprite->m_sprite_array;
+    sprite->m_array_bucket_pos = m_array_buckets[sprite_array].size();
+    m_array_buckets[sprite_array].push_back(sprite);
+
+    if (sprite->m_type == TYPE_PATH) {
+        m_path_index_valid = 0;
+    }
+}
+
+void cSprite_Manager::Remove_From_Buckets(cSprite* sprite)
+{
+    if (!Is_In_Buckets(sprite)) {
+        return;
+    }
+
+    // move the last sprite into the free position
+    cSprite_List& type_bucket = m_type_buckets[sprite->m_bucket_type];
+    cSprite* type_last = type_bucket.back();
+
+    type_bucket[sprite->m_type_bucket_pos] = type_last;
+    type_last->m_type_bucket_pos = sprite->m_type_bucket_pos;
+    type_bucket.pop_back();
+
+    cSprite_List& array_bucket = m_array_buckets[sprite->m_bucket_array];
+    cSprite* array_last = array_bucket.back();
+
+    array_bucket[sprite->m_array_bucket_pos] = array_last;
+    array_last->m_array_bucket_pos = sprite->m_array_bucket_pos;
+    array_bucket.pop_back();
+
+    if (sprite->m_bucket_type == TYPE_PATH) {
+        m_path_index_valid = 0;
+    }
+}
+
+bool cSprite_Manager::Is_In_Buckets(const cSprite* sprite) const
+{
+    const unsigned int type = sprite->m_bucket_type;
+
+    if (type >= m_type_buckets.size() || sprite->m_type_bucket_pos >= m_type_buckets[type].size()) {
+        return 0;
+    }
+
+    return m_type_buckets[type][sprite->m_type_bucket_pos] == sprite;
+}
+
+void cSprite_Manager::Clear_Buckets(void)
+{
+    for (SpriteBucketList::iterator itr = m_type_buckets.begin(); itr != m_type_buckets.end(); ++itr) {
+        itr->clear();
+    }
+    for (SpriteBucketList::iterator itr = m_array_buckets.begin(); itr != m_array_buckets.end(); ++itr) {
+        itr->clear();
+    }
+
+    m_path_index.clear();
+    m_path_index_valid = 0;
+}
+
+const int cSprite_Manager::m_update_region_cell_size = 256;
+
+// Return the distance of the value to the range
+static inline float Get_Distance_To_Range(float value, float range_start, float range_end)
+{
+    if (value < range_start) {
+        return range_start - value;
+    }
+    if (value > range_end) {
+        return value - range_end;
+    }
+
+    return 0.0f;
+}
+
+void cSprite_Manager::Update_Update_Region(void)
+{
+    // camera center as used by cSprite::Is_In_Range()
+    const float cam_center_x = pActive_Camera->m_x + (game_res_w / 2);
+    const float cam_center_y = pActive_Camera->m_y + (game_res_h / 2);
+    const int cell_x = static_cast<int>(floor(cam_center_x / m_update_region_cell_size));
+    const int cell_y = static_cast<int>(floor(cam_center_y / m_update_region_cell_size));
+
+    if (m_update_region_valid && cell_x == m_update_region_cell_x && cell_y == m_update_region_cell_y) {
+        return;
+    }
+
+    m_update_region_cell_x = cell_x;
+    m_update_region_cell_y = cell_y;
+    m_update_region_valid = 1;
+
+    // any camera center within the cell
+    const float cell_start_x = static_cast<float>(cell_x * m_update_region_cell_size);
+    const float cell_start_y = static_cast<float>(cell_y * m_update_region_cell_size);
+    const float cell_end_x = cell_start_x + m_update_region_cell_size;
+    const float cell_end_y = cell_start_y + m_update_region_cell_size;
+
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (!obj->m_update_range_gated || obj->m_no_camera) {
+            obj->m_update_region_active = 1;
+            continue;
+        }
+
+        // covers Is_In_Range() and Is_Visible_On_Screen()
+        const float half_w = obj->m_rect.m_w * 0.5f;
+        const float half_h = obj->m_rect.m_h * 0.5f;
+        const float range_x = std::max(static_cast<float>(obj->m_camera_range), (game_res_w * 0.5f) + half_w) + 1.0f;
+        const float range_y = std::max(static_cast<float>(obj->m_camera_range), (game_res_h * 0.5f) + half_h) + 1.0f;
+
+        obj->m_update_region_active = Get_Distance_To_Range(obj->m_rect.m_x + half_w, cell_start_x, cell_end_x) <= range_x &&
+                                      Get_Distance_To_Range(obj->m_rect.m_y + half_h, cell_start_y, cell_end_y) <= range_y;
+    }
+}
+
 void cSprite_Manager::Handle_Collision_Items(void)
 {
+    m_collision_awake_count = 0;
+    m_collision_sleeping_count = 0;
+
     for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         cSprite* obj = (*itr);
 
@@ -416,6 +791,14 @@ void cSprite_Manager::Handle_Collision_Items(void)
             continue;
         }
 
+        // nothing to do
+        if (obj->Is_Collision_Sleeping()) {
+            m_collision_sleeping_count++;
+            continue;
+        }
+
+        m_collision_awake_count++;
+
         // collision and movement handling
         obj->Collide_Move();
         // handle found collisions
@@ -425,15 +808,7 @@ void cSprite_Manager::Handle_Collision_Items(void)
 
 unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
 {
-    unsigned int count = 0;
-
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        if ((*itr)->m_sprite_array == sprite_array) {
-            count++;
-        }
-    }
-
-    return count;
+    return Get_Objects_by_Array(sprite_array).size();
 }
 
 /* The member m_uid_pool contains a list of all those UIDs that
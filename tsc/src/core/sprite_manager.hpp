@@ -20,6 +20,8 @@
 #include "../core/global_game.hpp"
 #include "../core/obj_manager.hpp"
 #include "../objects/movingsprite.hpp"
+#include "../core/spatial_hash.hpp"
+#include "../core/sprite_pool.hpp"
 
 namespace TSC {
 
@@ -35,6 +37,16 @@ namespace TSC {
          * it will not be touched, otherwise it is assigned a free UID.
          */
         virtual void Add(cSprite* sprite);
+        // Delete the sprite from the given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        /* Delete the given sprite
+         * a sprite from a pool is given back to it instead
+        */
+        virtual bool Delete(cSprite* sprite, bool delete_data = 1);
+        /* Remember the destroyed sprite so Add() can replace it without searching all sprites
+         * called from cSprite::Destroy(), does nothing if the sprite is not managed by this manager
+        */
+        void Sprite_Destroyed(cSprite* sprite);
 
         // Return a sprite copy
         cSprite* Copy(unsigned int identifier);
@@ -55,6 +67,40 @@ namespace TSC {
          */
         virtual void Delete_All(bool delayed = 0);
 
+        /* Return the sprites with the given type or array
+         * the buckets hold the sprites in no particular order and include destroyed sprites
+         * do not add or delete sprites while iterating them
+        */
+        inline const cSprite_List& Get_Objects_by_Type(const SpriteType type) const
+        {
+            if (static_cast<unsigned int>(type) >= m_type_buckets.size()) {
+                return m_empty_bucket;
+            }
+
+            return m_type_buckets[type];
+        }
+        inline const cSprite_List& Get_Objects_by_Array(const ArrayType sprite_array) const
+        {
+            if (static_cast<unsigned int>(sprite_array) >= m_array_buckets.size()) {
+                return m_empty_bucket;
+            }
+
+            return m_array_buckets[sprite_array];
+        }
+        /* Move the sprite to the buckets of its current type and array
+         * does nothing if the sprite is not managed by this manager
+        */
+        void Update_Sprite_Buckets(cSprite* sprite);
+        /* Return the not destroyed path with the given identifier or NULL
+         * Uses the path index which is built on the first call
+        */
+        cSprite* Get_Path_by_Identifier(const std::string& identifier);
+        // Build the path index again on the next use after a path identifier changed
+        inline void Invalidate_Path_Index(void)
+        {
+            m_path_index_valid = 0;
+        }
+
         // Return the first z position object from the given type
         cSprite* Get_First(const SpriteType type) const;
         // Return the last z position object from the given type
@@ -81,6 +127,21 @@ namespace TSC {
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
 
+        /* Get the objects with the start rect touching the given rectangle
+         * sorted from editor z position like Get_Objects_sorted()
+         * Uses the editor index which is built on the first call
+         * with_player : include player
+        */
+        void Get_Editor_Objects(cSprite_List& editor_objects, const GL_rect& rect, bool with_player = 0);
+        /* Update the editor index entry of the sprite after its start rect changed
+         * does nothing if the sprite is not indexed
+        */
+        void Update_Editor_Index(cSprite* sprite);
+        /* Remove all sprites from the editor index
+         * it gets built again on the next use
+        */
+        void Clear_Editor_Index(void);
+
         // Update items drawing validation
         inline void Update_Items_Valid_Draw(void)
         {
@@ -88,13 +149,32 @@ namespace TSC {
                 (*itr)->Update_Valid_Draw();
             }
         }
-        // Update items
+        /* Update items
+         * range gated sprites outside of the update region are skipped
+        */
         inline void Update_Items(void)
         {
+            Update_Update_Region();
+
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update();
+                cSprite* obj = (*itr);
+
+                if (!obj->m_update_region_active) {
+                    continue;
+                }
+
+                obj->Update();
             }
         }
+        /* Set the update region of the range gated sprites again
+         * if the camera entered another cell
+        */
+        void Update_Update_Region(void);
+        // Recalculate the update region on the next Update_Items()
+        inline void Invalidate_Update_Region(void)
+        {
+            m_update_region_valid = 0;
+        }
         // Update_Late items
         inline void Update_Items_Late(void)
         {
@@ -110,8 +190,35 @@ namespace TSC {
             }
         }
 
-        // Create Collision data and Handle the collisions
+        /* Create Collision data and Handle the collisions
+         * sprites for which Is_Collision_Sleeping() is true are skipped
+        */
         void Handle_Collision_Items(void);
+        // sprites handled and skipped by the last Handle_Collision_Items()
+        unsigned int m_collision_awake_count;
+        unsigned int m_collision_sleeping_count;
+
+        // Remember the current positions as start of the drawing interpolation
+        inline void Store_Interpolation_Pos(void)
+        {
+            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                (*itr)->Store_Interpolation_Pos();
+            }
+        }
+        // Move to the interpolated drawing positions
+        inline void Apply_Interpolation_Pos(const float alpha)
+        {
+            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                (*itr)->Apply_Interpolation_Pos(alpha);
+            }
+        }
+        // Move back to the real positions after drawing
+        inline void Restore_Interpolation_Pos(void)
+        {
+            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                (*itr)->Restore_Interpolation_Pos();
+            }
+        }
 
 
         /* Return the current size
@@ -125,6 +232,9 @@ namespace TSC {
             return Get_Pointer(identifier);
         }
 
+        // released fire and ice balls
+        cSprite_Pool<cBall> m_ball_pool;
+
         // Generate a new and unused sprite ID. Throws std::range_error if
         // no IDs can be generated anymore (more than INT_MAX objects are
         // requested).
@@ -193,6 +303,60 @@ namespace TSC {
          * are ensured to be placed in front of older ones.
          */
         void Ensure_Different_Z(cSprite* sprite);
+
+        // Index all sprites from their start rect
+        void Build_Editor_Index(void);
+        // Remove the sprite from the editor index
+        void Remove_From_Editor_Index(cSprite* sprite);
+
+        // Add the sprite to the buckets of its type and array
+        void Add_To_Buckets(cSprite* sprite);
+        // Remove the sprite from its buckets if it is in them
+        void Remove_From_Buckets(cSprite* sprite);
+        // Return true if the sprite is in the buckets of this manager
+        bool Is_In_Buckets(const cSprite* sprite) const;
+        // Remove all sprites from the buckets
+        void Clear_Buckets(void);
+
+        /* Start rects of the sprites while editing
+         * only valid in the editor as the start rects follow
+         * the sprites while playing
+        */
+        cSpatial_Hash<cSprite*> m_editor_index;
+        // rect each sprite is indexed with
+        typedef std::unordered_map<cSprite*, GL_rect> EditorIndexRectMap;
+        EditorIndexRectMap m_editor_index_rects;
+        // set if all sprites are indexed
+        bool m_editor_index_valid;
+
+        // camera cell size of the update region
+        static const int m_update_region_cell_size;
+        // camera center cell the update region was set for
+        int m_update_region_cell_x;
+        int m_update_region_cell_y;
+        // set if the update region matches the camera cell
+        bool m_update_region_valid;
+
+        /* Sprites by type and by array
+         * each sprite stores its bucket positions so it can be removed without searching
+        */
+        typedef vector<cSprite_List> SpriteBucketList;
+        SpriteBucketList m_type_buckets;
+        SpriteBucketList m_array_buckets;
+        // returned for types and arrays without a bucket
+        static const cSprite_List m_empty_bucket;
+
+        /* Destroyed sprites which can be replaced by Add()
+         * may hold sprites which were deleted elsewhere so they are only compared and not used
+         * before they are found in the objects
+        */
+        cSprite_List m_destroyed_sprites;
+
+        // paths by identifier
+        typedef std::unordered_map<std::string, cSprite*> PathIndexMap;
+        PathIndexMap m_path_index;
+        // set if all not destroyed paths are indexed
+        bool m_path_index_valid;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
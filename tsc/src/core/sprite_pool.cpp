@@ -0,0 +1,106 @@
+/***************************************************************************
+ * sprite_pool.cpp  -  Reusing short-lived sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/sprite_pool.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+// heap allocations of pooled sprites since the start
+static uint32_t sprite_pool_allocations = 0;
+
+uint32_t Get_Sprite_Pool_Allocations(void)
+{
+    return sprite_pool_allocations;
+}
+
+/* *** *** *** *** *** *** cSprite_Pool_Base *** *** *** *** *** *** *** *** *** *** *** */
+
+cSprite_Pool_Base::cSprite_Pool_Base(unsigned int max_free)
+{
+    m_free = NULL;
+    m_free_count = 0;
+    m_max_free = max_free;
+}
+
+cSprite_Pool_Base::~cSprite_Pool_Base(void)
+{
+    Clear();
+}
+
+void cSprite_Pool_Base::Release(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    if (m_free_count >= m_max_free) {
+        delete sprite;
+        return;
+    }
+
+    sprite->m_pool_next = m_free;
+    m_free = sprite;
+    m_free_count++;
+}
+
+void cSprite_Pool_Base::Clear(void)
+{
+    while (m_free) {
+        cSprite* sprite = m_free;
+        m_free = sprite->m_pool_next;
+        delete sprite;
+    }
+
+    m_free_count = 0;
+}
+
+void cSprite_Pool_Base::Count_Allocation(void)
+{
+    sprite_pool_allocations++;
+}
+
+void cSprite_Pool_Base::Release_Or_Delete(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    if (sprite->m_pool) {
+        sprite->m_pool->Release(sprite);
+    }
+    else {
+        delete sprite;
+    }
+}
+
+cSprite* cSprite_Pool_Base::Take_Free(void)
+{
+    cSprite* sprite = m_free;
+
+    if (!sprite) {
+        return NULL;
+    }
+
+    m_free = sprite->m_pool_next;
+    sprite->m_pool_next = NULL;
+    m_free_count--;
+
+    return sprite;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,95 @@
+/***************************************************************************
+ * sprite_pool.hpp  -  Reusing short-lived sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPRITE_POOL_HPP
+#define TSC_SPRITE_POOL_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cSprite_Pool_Base *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Keeps released sprites of one type for reuse
+     *
+     * The free sprites are linked through cSprite::m_pool_next so
+     * releasing and taking them allocates nothing. A sprite taken from
+     * the pool remembers it in cSprite::m_pool and the managers give it
+     * back with Release_Or_Delete() instead of deleting it. The released
+     * sprite keeps its images so they do not need to be loaded again.
+    */
+    class cSprite_Pool_Base {
+    public:
+        cSprite_Pool_Base(unsigned int max_free);
+        virtual ~cSprite_Pool_Base(void);
+
+        /* Keep the sprite for the next Take()
+         * deletes it if the pool is full
+        */
+        void Release(cSprite* sprite);
+        // Delete all free sprites
+        void Clear(void);
+        // Count a sprite which was allocated as the pool had none free
+        void Count_Allocation(void);
+
+        // Give the sprite back to its pool or delete it if it has none
+        static void Release_Or_Delete(cSprite* sprite);
+
+        // number of free sprites
+        unsigned int m_free_count;
+        // free sprites above this are deleted
+        unsigned int m_max_free;
+
+    protected:
+        // Return the first free sprite or NULL
+        cSprite* Take_Free(void);
+
+        // first free sprite
+        cSprite* m_free;
+    };
+
+    /* *** *** *** *** *** *** cSprite_Pool *** *** *** *** *** *** *** *** *** *** *** */
+
+    template<class T>
+    class cSprite_Pool : public cSprite_Pool_Base {
+    public:
+        cSprite_Pool(unsigned int max_free = 64)
+            : cSprite_Pool_Base(max_free)
+        {
+            //
+        }
+
+        /* Return a released sprite or NULL if none is free
+         * it still has the state it was released with and must be reset by the caller
+        */
+        T* Take(void)
+        {
+            return static_cast<T*>(Take_Free());
+        }
+    };
+
+    /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
+
+    /* Returns the number of pooled sprites
+     * which could not be reused and were allocated from the heap
+    */
+    uint32_t Get_Sprite_Pool_Allocations(void);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
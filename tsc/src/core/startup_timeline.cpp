@@ -0,0 +1,164 @@
+/***************************************************************************
+ * startup_timeline.cpp  -  Startup stages and worker tasks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/startup_timeline.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cStartup_Timeline *** *** *** *** *** *** *** *** *** *** *** */
+
+cStartup_Timeline::cStartup_Timeline(void)
+{
+    m_print = 0;
+    m_stage = NULL;
+    // set by Reset() as the start time may not be available yet
+    m_start_time = 0;
+}
+
+cStartup_Timeline::~cStartup_Timeline(void)
+{
+    Reset();
+}
+
+void cStartup_Timeline::Reset(void)
+{
+    for (vector<cEntry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        cEntry* entry = (*itr);
+
+        // never leave a running thread behind
+        if (entry->m_thread.joinable()) {
+            entry->m_thread.join();
+        }
+
+        delete entry;
+    }
+
+    m_entries.clear();
+    m_stage = NULL;
+    m_start_time = TSC_GetMicroTicks();
+}
+
+void cStartup_Timeline::Stage(const std::string& name)
+{
+    End_Stage();
+
+    debug_print("Startup stage %s\n", name.c_str());
+
+    m_stage = new cEntry();
+    m_stage->m_name = name;
+    m_stage->m_start = TSC_GetMicroTicks() - m_start_time;
+    m_stage->m_end = m_stage->m_start;
+    m_stage->m_task = 0;
+    m_entries.push_back(m_stage);
+}
+
+void cStartup_Timeline::End_Stage(void)
+{
+    if (!m_stage) {
+        return;
+    }
+
+    m_stage->m_end = TSC_GetMicroTicks() - m_start_time;
+    m_stage = NULL;
+}
+
+void cStartup_Timeline::Start_Task(const std::string& name, std::function<void(void)> function)
+{
+    cEntry* entry = new cEntry();
+    entry->m_name = name;
+    entry->m_start = TSC_GetMicroTicks() - m_start_time;
+    entry->m_end = entry->m_start;
+    entry->m_task = 1;
+    m_entries.push_back(entry);
+
+    entry->m_thread = boost::thread(&cStartup_Timeline::Run_Task, entry, function, m_start_time);
+}
+
+void cStartup_Timeline::Wait_Task(const std::string& name)
+{
+    cEntry* entry = Find_Task(name);
+
+    if (!entry) {
+        cerr << "Warning : Unknown startup task " << name << endl;
+        return;
+    }
+
+    if (entry->m_thread.joinable()) {
+        entry->m_thread.join();
+    }
+
+    if (entry->m_exception) {
+        std::exception_ptr exception = entry->m_exception;
+        entry->m_exception = std::exception_ptr();
+        std::rethrow_exception(exception);
+    }
+}
+
+void cStartup_Timeline::Print(void) const
+{
+    // formatted locally to keep the flags of cout
+    std::ostringstream out;
+    out << "Startup timeline :" << endl;
+    out << std::fixed << std::setprecision(2);
+
+    uint64_t end = 0;
+
+    for (vector<cEntry*>::const_iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        const cEntry* entry = (*itr);
+
+        out << "  " << (entry->m_task ? "task  " : "stage ") << std::left << std::setw(24) << entry->m_name << std::right
+            << std::setw(10) << (static_cast<float>(entry->m_start) / 1000.0f) << " ms"
+            << std::setw(10) << (static_cast<float>(entry->m_end - entry->m_start) / 1000.0f) << " ms" << endl;
+
+        if (entry->m_end > end) {
+            end = entry->m_end;
+        }
+    }
+
+    out << "  " << std::left << std::setw(30) << "total" << std::right << std::setw(10) << (static_cast<float>(end) / 1000.0f) << " ms" << endl;
+
+    cout << out.str();
+}
+
+void cStartup_Timeline::Run_Task(cEntry* entry, std::function<void(void)> function, uint64_t start_time)
+{
+    try {
+        function();
+    }
+    catch (...) {
+        entry->m_exception = std::current_exception();
+    }
+
+    entry->m_end = TSC_GetMicroTicks() - start_time;
+}
+
+cStartup_Timeline::cEntry* cStartup_Timeline::Find_Task(const std::string& name)
+{
+    for (vector<cEntry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        if ((*itr)->m_task && (*itr)->m_name == name) {
+            return (*itr);
+        }
+    }
+
+    return NULL;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,86 @@
+/***************************************************************************
+ * startup_timeline.hpp  -  Startup stages and worker tasks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STARTUP_TIMELINE_HPP
+#define TSC_STARTUP_TIMELINE_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cStartup_Timeline *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Records the wall time of the startup stages
+     *
+     * Stages run one after another on the main thread. Tasks run on a
+     * worker thread next to them and must be waited for before the
+     * first stage which depends on their result.
+    */
+    class cStartup_Timeline {
+    public:
+        cStartup_Timeline(void);
+        ~cStartup_Timeline(void);
+
+        // Remove all stages and start the time from now
+        void Reset(void);
+
+        // Start the next stage on the main thread
+        void Stage(const std::string& name);
+        // End the current stage on the main thread
+        void End_Stage(void);
+
+        // Run the function on a worker thread
+        void Start_Task(const std::string& name, std::function<void(void)> function);
+        /* Wait until the task is finished
+         * rethrows an exception thrown by the task
+        */
+        void Wait_Task(const std::string& name);
+
+        // Print the time of all stages and tasks
+        void Print(void) const;
+
+        // print the timeline after the startup
+        bool m_print;
+
+    private:
+        struct cEntry {
+            std::string m_name;
+            // microseconds from the start
+            uint64_t m_start;
+            uint64_t m_end;
+            // run on a worker thread
+            bool m_task;
+            boost::thread m_thread;
+            std::exception_ptr m_exception;
+        };
+
+        // Run the task function and record its end
+        static void Run_Task(cEntry* entry, std::function<void(void)> function, uint64_t start_time);
+
+        cEntry* Find_Task(const std::string& name);
+
+        // stages and tasks in start order
+        vector<cEntry*> m_entries;
+        // current stage or NULL
+        cEntry* m_stage;
+        // start time
+        uint64_t m_start_time;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -601,10 +601,9 @@ void cTurtleBoss::Throw_Fireballs(unsigned int amount /* = 6 */)
         // add step size to angle
         ball_angle += step_size;
 
-        cBall* ball = new cBall(m_sprite_manager);
+        cBall* ball = cBall::Create(m_sprite_manager, FIREBALL_EXPLOSION);
         ball->Set_Pos(m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2, 1);
         ball->Set_Origin(m_sprite_array, m_type);
-        ball->Set_Ball_Type(FIREBALL_EXPLOSION);
         ball->Set_Velocity_From_Angle(ball_angle, 15);
         if (ball->m_velx > 0.0f) {
             ball->m_direction = DIR_RIGHT;
@@ -617,7 +616,7 @@ void cTurtleBoss::Throw_Fireballs(unsigned int amount /* = 6 */)
         m_sprite_manager->Add(ball);
     }
 
-    cAnimation_Fireball* anim = new cAnimation_Fireball(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 2), m_pos_y + (m_col_rect.m_h / 3), 10);
+    cAnimation_Fireball* anim = cAnimation_Fireball::Create(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 2), m_pos_y + (m_col_rect.m_h / 3), 10);
     anim->Set_Fading_Speed(0.15f);
     anim->Set_Pos_Z(m_pos_z + m_pos_z_delta);
     pActive_Animation_Manager->Add(anim);
@@ -188,7 +188,7 @@ void cFurball::Set_Color(const DefaultColor& col)
     }
     else if (m_color_type == COL_BLACK) {
         filename_dir = "boss";
-        m_type = TYPE_FURBALL_BOSS;
+        Set_Sprite_Type(TYPE_FURBALL_BOSS);
 
         m_kill_points = 2500;
         m_fire_resistant = 1;
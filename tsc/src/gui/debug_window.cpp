@@ -24,6 +24,7 @@
 #include "../overworld/overworld.hpp"
 #include "../objects/bonusbox.hpp"
 #include "../scene/scene.hpp"
+#include "../gui/generic.hpp"
 #include "debug_window.hpp"
 
 // extern
@@ -85,6 +86,17 @@ void cDebug_Window::Set_Sprite_Manager(cSprite_Manager* p_sprite_manager)
     mp_sprite_manager = p_sprite_manager;
 }
 
+void cDebug_Window::Set_Child_Text(const std::string& name, const char* text)
+{
+    std::map<std::string, cWindow_Text>::iterator iter = m_child_texts.find(name);
+
+    if (iter == m_child_texts.end()) {
+        iter = m_child_texts.insert(std::make_pair(name, cWindow_Text(mp_debugwin_root->getChild(name)))).first;
+    }
+
+    iter->second.Set_Text(text);
+}
+
 bool cDebug_Window::IsVisible()
 {
     return mp_debugwin_root->isVisible();
@@ -104,14 +116,14 @@ void cDebug_Window::Update()
              pFramerate->m_fps_best,
              pFramerate->m_fps_worst,
              pFramerate->m_fps);
-    mp_debugwin_root->getChild("fps")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("fps", buf);
 
     snprintf(buf,
              4096,
              _("Camera X: %d Y: %d"),
              static_cast<int>(pActive_Camera->m_x),
              static_cast<int>(pActive_Camera->m_y));
-    mp_debugwin_root->getChild("camera")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("camera", buf);
 
     switch (Game_Mode) {
     case MODE_LEVEL:
@@ -136,7 +148,7 @@ void cDebug_Window::Update()
         snprintf(buf, 4096, "--");
         break;
     } // No default to let the compiler warn about missed values
-    mp_debugwin_root->getChild("general")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("general", buf);
 
     // Count specific objects
     int halfmassives = 0;
@@ -168,38 +180,41 @@ void cDebug_Window::Update()
              mp_sprite_manager->Get_Size_Array(ARRAY_ENEMY),
              mp_sprite_manager->Get_Size_Array(ARRAY_ACTIVE),
              halfmassives);
-    mp_debugwin_root->getChild("objectcount")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("objectcount", buf);
 
     snprintf(buf,
              4096,
              // TRANS: Abbreviations mean:
              // TRANS: BBox=Bonus boxes, GBox=Gold boxes, MPlat=Moving platforms
-             _("BBox: %d GBox: %d MPlat: %d"),
+             // TRANS: Awake/Sleep=Sprites handled/skipped by the collision handling
+             _("BBox: %d GBox: %d MPlat: %d Awake: %u Sleep: %u"),
              bonusboxes - goldboxes,
              goldboxes,
-             moving_platforms);
-    mp_debugwin_root->getChild("objectcount2")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+             moving_platforms,
+             mp_sprite_manager->m_collision_awake_count,
+             mp_sprite_manager->m_collision_sleeping_count);
+    Set_Child_Text("objectcount2", buf);
 
     snprintf(buf,
              4096,
              _("Player X1: %.4f X2: %.4f"),
              pActive_Player->m_pos_x,
              pLevel_Player->m_col_rect.m_x + pLevel_Player->m_col_rect.m_w);
-    mp_debugwin_root->getChild("player_info")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("player_info", buf);
 
     snprintf(buf,
              4096,
              _("Player Y1: %.4f Y2: %.4f"),
              pActive_Player->m_pos_y,
              pLevel_Player->m_col_rect.m_y + pLevel_Player->m_col_rect.m_h);
-    mp_debugwin_root->getChild("player_info2")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("player_info2", buf);
 
     snprintf(buf,
              4096,
              _("Player XVel: %.4f, YVel: %.4f"),
              pLevel_Player->m_velx,
              pLevel_Player->m_vely);
-    mp_debugwin_root->getChild("player_info3")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("player_info3", buf);
 
     snprintf(buf,
              4096,
@@ -207,11 +222,69 @@ void cDebug_Window::Update()
              static_cast<int>(pLevel_Player->m_state),
              pLevel_Player->m_ground_object ? static_cast<int>(pLevel_Player->m_ground_object->m_massive_type) : -1,
              pLevel_Player->m_ground_object ? Get_Massive_Type_Name(pLevel_Player->m_ground_object->m_massive_type).c_str() : "--");
-    mp_debugwin_root->getChild("player_info4")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("player_info4", buf);
 
     snprintf(buf,
              4096,
              _("Game Mode: %d"),
              Game_Mode);
-    mp_debugwin_root->getChild("game_mode")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+    Set_Child_Text("game_mode", buf);
+
+    // Level scripts
+    const Scripting::cScript_Profile_Entry* p_slowest = NULL;
+    const Scripting::cScript_Profile_Entry* p_top = NULL;
+    uint64_t script_us = 0;
+
+    if (pActive_Level && pActive_Level->m_mruby) {
+        const Scripting::cScript_Profiler& profiler = pActive_Level->m_mruby->Get_Profiler();
+        std::vector<const Scripting::cScript_Profile_Entry*> entries = profiler.Get_Entries();
+
+        script_us = profiler.Get_Last_Frame_Time();
+        p_slowest = profiler.Get_Last_Frame_Slowest();
+
+        if (!entries.empty()) {
+            p_top = entries.front();
+        }
+    }
+
+    snprintf(buf,
+             4096,
+             _("Scripts: %.2f ms Slowest: %s"),
+             script_us / 1000.0f,
+             p_slowest ? p_slowest->m_location.c_str() : "--");
+    Set_Child_Text("scripts", buf);
+
+    if (p_top) {
+        snprintf(buf,
+                 4096,
+                 // TRANS: Statistics of the script location which took the most time
+                 _("Top: %s Calls: %u Total: %.1f ms Max: %.2f ms Objects: %ld"),
+                 p_top->m_location.c_str(),
+                 p_top->m_calls,
+                 p_top->m_total_us / 1000.0f,
+                 p_top->m_max_us / 1000.0f,
+                 static_cast<long>(p_top->m_objects));
+    }
+    else {
+        snprintf(buf, 4096, "--");
+    }
+    Set_Child_Text("scripts2", buf);
+
+    if (pActive_Level && pActive_Level->m_mruby) {
+        const Scripting::cGC_Statistics& gc = pActive_Level->m_mruby->Get_GC_Scheduler().Get_Statistics();
+
+        snprintf(buf,
+                 4096,
+                 // TRANS: Pauses of the script garbage collection
+                 _("Script GC: %.2f ms Max step: %.2f ms Full: %u (max %.1f ms) Forced: %u"),
+                 gc.m_last_frame_us / 1000.0f,
+                 gc.m_step_us_max / 1000.0f,
+                 gc.m_full_collections,
+                 gc.m_full_us_max / 1000.0f,
+                 gc.m_forced_frames);
+    }
+    else {
+        snprintf(buf, 4096, "--");
+    }
+    Set_Child_Text("script_gc", buf);
 }
@@ -16,6 +16,8 @@
 #ifndef TSC_DEBUG_WINDOW_HPP
 #define TSC_DEBUG_WINDOW_HPP
 
+#include "../gui/generic.hpp"
+
 namespace TSC {
 
     class cDebug_Window
@@ -31,8 +33,13 @@ namespace TSC {
         void Set_Sprite_Manager(cSprite_Manager* p_sprite_manager);
         void Update();
     private:
+        // Set the text of the given child window if it changed
+        void Set_Child_Text(const std::string& name, const char* text);
+
         cSprite_Manager* mp_sprite_manager;
         CEGUI::Window* mp_debugwin_root;
+        // displayed texts by child window name
+        std::map<std::string, cWindow_Text> m_child_texts;
     };
 
     extern cDebug_Window* gp_debug_window;
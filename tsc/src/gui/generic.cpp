@@ -319,6 +319,38 @@ bool cDialogBox_Question::Button_cancel_clicked(const CEGUI::EventArgs& event)
     return 1;
 }
 
+/* *** *** *** *** *** *** *** cWindow_Text *** *** *** *** *** *** *** *** *** *** */
+
+cWindow_Text::cWindow_Text(CEGUI::Window* p_window /* = NULL */)
+    : mp_window(p_window), m_valid(0)
+{
+    //
+}
+
+void cWindow_Text::Set_Window(CEGUI::Window* p_window)
+{
+    mp_window = p_window;
+    Invalidate();
+}
+
+bool cWindow_Text::Set_Text(const std::string& text)
+{
+    if (!mp_window || (m_valid && m_text == text)) {
+        return 0;
+    }
+
+    m_text = text;
+    m_valid = 1;
+    mp_window->setText(reinterpret_cast<const CEGUI::utf8*>(m_text.c_str()));
+
+    return 1;
+}
+
+void cWindow_Text::Invalidate(void)
+{
+    m_valid = 0;
+}
+
 /* *** *** *** *** *** *** *** Functions *** *** *** *** *** *** *** *** *** *** */
 
 void Gui_Handle_Time(void)
@@ -94,6 +94,40 @@ namespace TSC {
         int return_value;
     };
 
+    /* *** *** *** *** *** *** *** cWindow_Text *** *** *** *** *** *** *** *** *** *** */
+
+    /* Displayed text of a CEGUI window
+     * CEGUI parses the formatting tags and rebuilds the window geometry
+     * on every setText() even if the text did not change, so this only
+     * passes the text on if it differs from the displayed one.
+     */
+    class cWindow_Text {
+    public:
+        cWindow_Text(CEGUI::Window* p_window = NULL);
+
+        // Set the window
+        void Set_Window(CEGUI::Window* p_window);
+        /* Set the text
+         * returns true if the window text was changed
+         */
+        bool Set_Text(const std::string& text);
+        // Forget the displayed text and always set it the next time
+        void Invalidate(void);
+
+        // Return the window
+        CEGUI::Window* Get_Window(void) const
+        {
+            return mp_window;
+        }
+
+    private:
+        CEGUI::Window* mp_window;
+        // displayed text
+        std::string m_text;
+        // if m_text is the displayed text
+        bool m_valid;
+    };
+
     /* *** *** *** *** *** *** *** Functions *** *** *** *** *** *** *** *** *** *** */
 
 // Update The GUI time handler
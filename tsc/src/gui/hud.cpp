@@ -16,6 +16,9 @@
 #include "../core/framerate.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/sprite_manager.hpp"
+#include "../gui/generic.hpp"
+#include "../video/video.hpp"
+#include "../core/editor/editor.hpp"
 #include "hud.hpp"
 
 // 35 is the number of pixels set in berry's .settings file.
@@ -56,7 +59,8 @@ cHud::cHud()
       m_elapsed_time(0), m_last_time(std::chrono::system_clock::now()),
       m_text_counter(0.0f), mp_hud_root(NULL), mp_points_label(NULL), mp_time_label(NULL),
       mp_jewels_label(NULL), mp_lives_label(NULL),
-      mp_waypoint_label(NULL), mp_world_label(NULL), mp_message_text(NULL), mp_item_image(NULL)
+      mp_waypoint_label(NULL), mp_world_label(NULL), mp_message_text(NULL), mp_item_image(NULL),
+      m_displayed_seconds(-1)
 {
     load_hud_images_into_cegui();
 
@@ -73,6 +77,13 @@ cHud::cHud()
     mp_message_text   = mp_hud_root->getChild("message");
     mp_item_image     = mp_hud_root->getChild("itembox_image/item_image");
 
+    m_points_text.Set_Window(mp_points_label);
+    m_time_text.Set_Window(mp_time_label);
+    m_jewels_text.Set_Window(mp_jewels_label);
+    m_lives_text.Set_Window(mp_lives_label);
+    m_waypoint_text.Set_Window(mp_waypoint_label);
+    m_world_text.Set_Window(mp_world_label);
+
     mp_hud_root->hide();
     CEGUI::System::getSingleton()
         .getDefaultGUIContext()
@@ -102,6 +113,11 @@ cHud::~cHud()
     }
     m_active_mini_points.clear();
 
+    for(iter=m_unused_mini_points.begin(); iter != m_unused_mini_points.end(); iter++) {
+        delete (*iter);
+    }
+    m_unused_mini_points.clear();
+
     CEGUI::System::getSingleton()
         .getDefaultGUIContext()
         .getRootWindow()
@@ -136,9 +152,6 @@ void cHud::Hide()
 
 void cHud::Update()
 {
-    static char timestr[32];
-    static int seconds;
-
     // Update elapsed time
     if (Game_Mode == MODE_LEVEL) {
         // Do not add to elapsed time while in editor. m_last_time
@@ -154,10 +167,8 @@ void cHud::Update()
 
             m_elapsed_time += time_elapsed.count();
             m_last_time     = time_now;
-            seconds         = m_elapsed_time / 1000;
 
-            sprintf(timestr, _("Time %02d:%02d"), seconds / 60, seconds % 60);
-            mp_time_label->setText(timestr);
+            Update_Time_Label();
         }
     }
 
@@ -165,8 +176,9 @@ void cHud::Update()
     std::vector<cMiniPoints*>::iterator iter;
     for(iter=m_active_mini_points.begin(); iter != m_active_mini_points.end();) {
         if ((*iter)->Update()) {
-            // If they're done displaying, delete them and remove them from the vector.
-            delete (*iter);
+            // If they're done displaying, hide them and keep them for reuse.
+            (*iter)->Stop();
+            m_unused_mini_points.push_back(*iter);
             iter = m_active_mini_points.erase(iter);
         }
         else {
@@ -184,6 +196,26 @@ void cHud::Update()
     }
 }
 
+/**
+ * Formats the time label, but only if the displayed second changed
+ * since the last call. The label only shows full seconds, so most
+ * frames do not need to touch CEGUI at all.
+ */
+void cHud::Update_Time_Label()
+{
+    int seconds = m_elapsed_time / 1000;
+
+    if (seconds == m_displayed_seconds)
+        return;
+
+    m_displayed_seconds = seconds;
+
+    char str[32];
+    memset(str, '\0', 32);
+    snprintf(str, 32, _("Time %02d:%02d"), seconds / 60, seconds % 60);
+    m_time_text.Set_Text(str);
+}
+
 void cHud::Set_Points(long points)
 {
     m_points = points;
@@ -191,7 +223,7 @@ void cHud::Set_Points(long points)
     char str[32];
     memset(str, '\0', 32);
     sprintf(str, _("Points %08ld"), m_points);
-    mp_points_label->setText(str);
+    m_points_text.Set_Text(str);
 }
 
 void cHud::Add_Points(long points, float x /* = 0.0f */, float y /* = 0.0f */, std::string strtext /* = "" */, const Color& color /* = 255 */, bool allow_multiplier /* = false */)
@@ -211,7 +243,18 @@ void cHud::Add_Points(long points, float x /* = 0.0f */, float y /* = 0.0f */, s
         strtext = int_to_string(points);
     }
 
-    m_active_mini_points.push_back(new cMiniPoints(strtext, x, y, color));
+    // reuse a finished one if possible
+    cMiniPoints* p_mini_points = NULL;
+    if (m_unused_mini_points.empty()) {
+        p_mini_points = new cMiniPoints();
+    }
+    else {
+        p_mini_points = m_unused_mini_points.back();
+        m_unused_mini_points.pop_back();
+    }
+
+    p_mini_points->Start(strtext, x, y, color);
+    m_active_mini_points.push_back(p_mini_points);
 }
 
 void cHud::Reset_Points()
@@ -244,7 +287,7 @@ void cHud::Set_Jewels(int jewels)
     char str[8];
     memset(str, '\0', 8);
     sprintf(str, "%02d", m_jewels);
-    mp_jewels_label->setText(str);
+    m_jewels_text.Set_Text(str);
 
     // Change text colour with more and more jewels collected
     // OLD Color color = Color(static_cast<uint8_t>(255), 255, 255 - (gold * 2));
@@ -275,7 +318,7 @@ void cHud::Set_Lives(int lives)
     char str[32];
     memset(str, '\0', 32);
     sprintf(str, "[colour='FF00FF00']%02d x", m_lives);
-    mp_lives_label->setText(str);
+    m_lives_text.Set_Text(str);
 }
 
 void cHud::Add_Lives(int lives)
@@ -296,12 +339,14 @@ int cHud::Get_Lives()
 void cHud::Set_Elapsed_Time(uint32_t milliseconds)
 {
     m_elapsed_time = milliseconds;
+    Update_Time_Label();
 }
 
 void cHud::Reset_Elapsed_Time()
 {
     m_elapsed_time = 0;
     m_last_time = std::chrono::system_clock::now();
+    Update_Time_Label();
 }
 
 uint32_t cHud::Get_Elapsed_Time()
@@ -389,12 +434,12 @@ void cHud::Reset()
 void cHud::Set_Waypoint_Name(std::string name, Color color)
 {
     // TODO: Apply color
-    mp_waypoint_label->setText(name);
+    m_waypoint_text.Set_Text(name);
 }
 
 void cHud::Set_World_Name(std::string name)
 {
-    mp_world_label->setText(std::string("[colour='FFFFFF00']") + name);
+    m_world_text.Set_Text(std::string("[colour='FFFFFF00']") + name);
 }
 
 void cHud::Set_Text(std::string message)
@@ -404,6 +449,20 @@ void cHud::Set_Text(std::string message)
     m_text_counter = TEXT_DISPLAY_TIME;
 }
 
+/* Returns the CEGUI image of the given game pixmap or
+ * the not found image if the surface could not be loaded
+*/
+static std::string load_hud_item_image(const std::string& filename)
+{
+    cGL_Surface* surface = pVideo->Get_Surface(filename);
+
+    if (!surface) {
+        return cEditor::load_cegui_image(pResource_Manager->Get_Game_Pixmap("game/image_not_found.png"));
+    }
+
+    return cEditor::load_cegui_image(surface->Get_Real_PNG_Path());
+}
+
 void cHud::load_hud_images_into_cegui()
 {
     CEGUI::ImageManager& imgmanager = CEGUI::ImageManager::getSingleton();
@@ -412,15 +471,11 @@ void cHud::load_hud_images_into_cegui()
     imgmanager.addFromImageFile("hud_alex",    "game/hud_alex.png",    "ingame-images");
     imgmanager.addFromImageFile("hud_itembox", "game/hud_itembox.png", "ingame-images");
 
-    m_normal_berry_img = path_to_utf8(pResource_Manager->Get_User_Pixmap("game/items/mushroom_red.png"));
-    m_fire_berry_img   = path_to_utf8(pResource_Manager->Get_User_Pixmap("game/items/fireberry_1.png"));
-    m_ice_berry_img    = path_to_utf8(pResource_Manager->Get_User_Pixmap("game/items/mushroom_blue.png"));
-
-    // Convert the pathes to the names they are stored under in CEGUI
-    // (see cEditor::load_cegui_image(), which is executed on game startup).
-    string_replace_all(m_normal_berry_img, "/", "+");
-    string_replace_all(m_fire_berry_img,   "/", "+");
-    string_replace_all(m_ice_berry_img,    "/", "+");
+    // Stored under the same names as the editor item images as the editor
+    // may load them too, but only once it is opened (see cEditor::load_cegui_image()).
+    m_normal_berry_img = load_hud_item_image("game/items/mushroom_red.png");
+    m_fire_berry_img   = load_hud_item_image("game/items/fireberry_1.png");
+    m_ice_berry_img    = load_hud_item_image("game/items/mushroom_blue.png");
 }
 
 /**
@@ -477,18 +532,18 @@ cHudSprite* cHudSprite::Copy(void) const
     return hud_sprite;
 }
 
-cMiniPoints::cMiniPoints(std::string pointstext, float x, float y, Color color)
-    : mp_label(NULL), m_counter(MINIPOINTS_DISPLAY_TIME),
-      m_x(x), m_y(y)
+cMiniPoints::cMiniPoints()
+    : mp_label(NULL), m_counter(0.0f),
+      m_x(0.0f), m_y(0.0f)
 {
     CEGUI::Window* p_root = CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow();
     CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
 
-    // TODO: Apply color
-
     mp_label = wmgr.createWindow("TSCLook256/Label");
-    mp_label->setText(pointstext);
+    mp_label->hide();
     p_root->addChild(mp_label);
+
+    m_label_text.Set_Window(mp_label);
 }
 
 cMiniPoints::~cMiniPoints()
@@ -501,6 +556,31 @@ cMiniPoints::~cMiniPoints()
     mp_label = NULL;
 }
 
+/**
+ * Displays the given text at the given level position. Call Update()
+ * once per frame afterwards until it returns true, then Stop().
+ */
+void cMiniPoints::Start(const std::string& pointstext, float x, float y, Color color)
+{
+    m_counter = MINIPOINTS_DISPLAY_TIME;
+    m_x = x;
+    m_y = y;
+
+    // TODO: Apply color
+
+    m_label_text.Set_Text(pointstext);
+    mp_label->show();
+}
+
+/**
+ * Hides the text. The instance can be reused with Start() afterwards.
+ */
+void cMiniPoints::Stop()
+{
+    m_counter = 0;
+    mp_label->hide();
+}
+
 /**
  * Decreases the internal show counter, updates the position of the text as
  * required to adjust to camera movements, and returns true if the text is
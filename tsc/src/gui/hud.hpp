@@ -17,18 +17,29 @@
 #ifndef TSC_HUD_HPP
 #define TSC_HUD_HPP
 
+#include "../gui/generic.hpp"
+
 namespace TSC {
 
+    /**
+     * Points text shown for a short time at a level position, e.g. next
+     * to a killed enemy. Instances are pooled by cHud: the CEGUI window
+     * is created once and only hidden while the instance is unused, as
+     * creating and destroying CEGUI windows is expensive.
+     */
     class cMiniPoints
     {
     public:
-        cMiniPoints(std::string pointstext, float x, float y, Color color);
+        cMiniPoints();
         ~cMiniPoints();
 
+        void Start(const std::string& pointstext, float x, float y, Color color);
+        void Stop();
         bool Update();
 
     private:
         CEGUI::Window* mp_label;
+        cWindow_Text m_label_text;
         float m_counter;
         float m_x;
         float m_y;
@@ -91,6 +102,7 @@ namespace TSC {
         void Screen_Size_Changed();
 
     private:
+        void Update_Time_Label();
         long m_points;
         int m_jewels;
         int m_lives;
@@ -110,6 +122,16 @@ namespace TSC {
         CEGUI::Window* mp_message_text;
         CEGUI::Window* mp_item_image;
 
+        // Only changed if the displayed value changes
+        cWindow_Text m_points_text;
+        cWindow_Text m_time_text;
+        cWindow_Text m_jewels_text;
+        cWindow_Text m_lives_text;
+        cWindow_Text m_waypoint_text;
+        cWindow_Text m_world_text;
+        // Currently displayed elapsed seconds, -1 if none yet
+        int m_displayed_seconds;
+
         // Names the berries are available under in CEGUI
         // as images.
         std::string m_normal_berry_img;
@@ -117,6 +139,8 @@ namespace TSC {
         std::string m_ice_berry_img;
 
         std::vector<cMiniPoints*> m_active_mini_points;
+        // Finished minipoints for reuse
+        std::vector<cMiniPoints*> m_unused_mini_points;
 
         void load_hud_images_into_cegui();
     };
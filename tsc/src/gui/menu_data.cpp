@@ -599,6 +599,8 @@ void cMenu_Start::Init_GUI(void)
     // ### Level ###
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
     listbox_levels->setSortingEnabled(1);
+    // shows the level information from the level catalog
+    listbox_levels->setItemTooltipsEnabled(1);
 
     // events
     listbox_levels->subscribeEvent(CEGUI::Listbox::EventSelectionChanged, CEGUI::Event::Subscriber(&cMenu_Start::Level_Select, this));
@@ -694,35 +696,36 @@ void cMenu_Start::Draw(void)
     Draw_End();
 }
 
-void cMenu_Start::Get_Levels(fs::path dir, CEGUI::Colour color)
+void cMenu_Start::Get_Levels(void)
 {
     CEGUI::Window* p_root = CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow();
 
     // Level Listbox
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
 
-    // get all files
-    // .tsclvl is the new TSC level format, but .smclvl is listed for reverse compatibility
-    vector<fs::path> lvl_files = Get_Directory_Files(dir, ".tsclvl", false, false);
-    vector<fs::path> lvl_files2 = Get_Directory_Files(dir, ".smclvl", false, false);
-    lvl_files.insert(lvl_files.end(), lvl_files2.begin(), lvl_files2.end());
+    // only reads the level files which changed since the last time
+    pLevel_Manager->m_catalog.Update();
 
-    // list all available levels
-    for (vector<fs::path>::iterator itr = lvl_files.begin(); itr != lvl_files.end(); ++itr) {
-        // get filename without base directory
-        fs::path lvl_path = (*itr).filename();
+    // sorted once after all items are added
+    listbox_levels->setSortingEnabled(0);
 
-        // erase file extension only if tsclvl or smclvl (reverse compatibilty)
-        if (lvl_path.extension() == fs::path(".tsclvl") || lvl_path.extension() == fs::path(".smclvl"))
-            lvl_path = lvl_path.stem();
+    // items by level name
+    std::unordered_map<std::string, CEGUI::ListboxTextItem*> items;
 
+    // list all available levels
+    for (const cLevel_Catalog_Entry& entry: pLevel_Manager->m_catalog.m_entries) {
         // create listbox item
-        std::string lvl_name = path_to_utf8(lvl_path);
-        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(reinterpret_cast<const CEGUI::utf8*>(lvl_name.c_str()));
-        item->setTextColours(color);
+        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(reinterpret_cast<const CEGUI::utf8*>(entry.m_name.c_str()));
+
+        if (entry.m_user) {
+            item->setTextColours(CEGUI::Colour(0.8f, 1, 0.6f));
+        }
+        else {
+            item->setTextColours(CEGUI::Colour(1, 0.8f, 0.6f));
+        }
 
         // check if item with the same name already exists
-        CEGUI::ListboxTextItem* item_old = static_cast<CEGUI::ListboxTextItem*>(listbox_levels->findItemWithText(lvl_name, NULL));
+        CEGUI::ListboxTextItem*& item_old = items[entry.m_name];
 
         if (item_old) {
             // mix colors
@@ -731,11 +734,30 @@ void cMenu_Start::Get_Levels(fs::path dir, CEGUI::Colour color)
             listbox_levels->removeItem(item_old);
         }
 
+        item_old = item;
 
+        // level information
+        std::string tooltip;
+
+        if (!entry.m_author.empty()) {
+            tooltip += _("Author") + std::string(": ") + entry.m_author + "\n";
+        }
+
+        if (entry.m_difficulty > 0) {
+            tooltip += _("Difficulty") + std::string(": ") + int_to_string(entry.m_difficulty) + "\n";
+        }
+
+        if (!entry.m_description.empty()) {
+            tooltip += entry.m_description;
+        }
+
+        item->setTooltipText(reinterpret_cast<const CEGUI::utf8*>(tooltip.c_str()));
         item->setSelectionColours(CEGUI::Colour(0.33f, 0.33f, 0.33f));
         item->setSelectionBrushImage("TSCLook256/ListboxSelectionBrush");
         listbox_levels->addItem(item);
     }
+
+    listbox_levels->setSortingEnabled(1);
 }
 
 bool cMenu_Start::Highlight_Level(std::string lvl_name)
@@ -987,10 +1009,8 @@ void cMenu_Start::Update_Lists(void)
     CEGUI::Listbox* listbox_levels = static_cast<CEGUI::Listbox*>(p_root->getChild("menu_overworld/tabcontrol_main/tab_level/listbox_levels"));
     listbox_levels->resetList();
 
-    // get game level
-    Get_Levels(pResource_Manager->Get_Game_Level_Directory(), CEGUI::Colour(1, 0.8f, 0.6f));
-    // get user level
-    Get_Levels(pResource_Manager->Get_User_Level_Directory(), CEGUI::Colour(0.8f, 1, 0.6f));
+    // get game and user level
+    Get_Levels();
 }
 
 bool cMenu_Start::TabControl_Selection_Changed(const CEGUI::EventArgs& e)
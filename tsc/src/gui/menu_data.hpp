@@ -137,8 +137,8 @@ namespace TSC {
         virtual void Update(void);
         virtual void Draw(void);
 
-        // Get all levels from the given directory
-        void Get_Levels(boost::filesystem::path dir, CEGUI::Colour color);
+        // Get all levels from the game and user level directories
+        void Get_Levels(void);
 
         /* Highlight the given level
          * and activates level tab if needed
@@ -0,0 +1,324 @@
+/***************************************************************************
+ * input_log.cpp  -  Per-tick log of input events
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/math/utilities.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../user/preferences.hpp"
+#include "../input/input_log.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cInput_Log *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Log::cInput_Log(void)
+{
+    m_seed = 0;
+    m_replay_pos = 0;
+    m_frame_time_pos = 0;
+    m_parse_error = 0;
+}
+
+cInput_Log::~cInput_Log(void)
+{
+    //
+}
+
+void cInput_Log::Clear(void)
+{
+    m_events.clear();
+    m_frame_times.clear();
+    m_seed = 0;
+    m_replay_pos = 0;
+    m_frame_time_pos = 0;
+}
+
+bool cInput_Log::Load_From_File(const fs::path& filename)
+{
+    Clear();
+    m_parse_error = 0;
+
+    if (!Parse(filename)) {
+        return 0;
+    }
+
+    // allow unordered files
+    std::stable_sort(m_events.begin(), m_events.end(), [](const cLogged_Event& a, const cLogged_Event& b) {
+        return a.m_tick < b.m_tick;
+    });
+    std::stable_sort(m_frame_times.begin(), m_frame_times.end(), [](const cLogged_Frame_Time& a, const cLogged_Frame_Time& b) {
+        return a.m_tick < b.m_tick;
+    });
+
+    return !m_parse_error;
+}
+
+bool cInput_Log::Save_To_File(const fs::path& filename) const
+{
+    fs::ofstream ofs(filename, ios::out | ios::trunc);
+
+    if (!ofs) {
+        cerr << "Error : Could not write input log " << path_to_utf8(filename) << endl;
+        return 0;
+    }
+
+    ofs << "# tsc input log" << endl;
+    ofs << "0 seed " << m_seed << endl;
+
+    LoggedFrameTimeList::const_iterator frame_itr = m_frame_times.begin();
+
+    for (LoggedEventList::const_iterator itr = m_events.begin(); itr != m_events.end(); ++itr) {
+        // frame times of the ticks up to this event
+        for (; frame_itr != m_frame_times.end() && frame_itr->m_tick <= itr->m_tick; ++frame_itr) {
+            ofs << frame_itr->m_tick << " elapsed " << frame_itr->m_elapsed_ticks << endl;
+        }
+
+        const sf::Event& evt = itr->m_event;
+        ofs << itr->m_tick << " ";
+
+        if (evt.type == sf::Event::KeyPressed || evt.type == sf::Event::KeyReleased) {
+            ofs << (evt.type == sf::Event::KeyPressed ? "key_down " : "key_up ") << static_cast<int>(evt.key.code);
+
+            const int modifiers = (evt.key.alt ? 1 : 0) | (evt.key.control ? 2 : 0) | (evt.key.shift ? 4 : 0) | (evt.key.system ? 8 : 0);
+
+            if (modifiers) {
+                ofs << " " << modifiers;
+            }
+        }
+        else if (evt.type == sf::Event::TextEntered) {
+            ofs << "text " << evt.text.unicode;
+        }
+        else if (evt.type == sf::Event::JoystickButtonPressed || evt.type == sf::Event::JoystickButtonReleased) {
+            ofs << (evt.type == sf::Event::JoystickButtonPressed ? "joy_down " : "joy_up ") << evt.joystickButton.button;
+        }
+        else {
+            ofs << "joy_axis " << static_cast<int>(evt.joystickMove.axis) << " " << evt.joystickMove.position;
+        }
+
+        ofs << endl;
+    }
+
+    for (; frame_itr != m_frame_times.end(); ++frame_itr) {
+        ofs << frame_itr->m_tick << " elapsed " << frame_itr->m_elapsed_ticks << endl;
+    }
+
+    return 1;
+}
+
+bool cInput_Log::Add_Event(uint32_t tick, const sf::Event& evt)
+{
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased:
+    case sf::Event::TextEntered:
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased:
+    case sf::Event::JoystickMoved:
+        break;
+    default:
+        return 0;
+    }
+
+    cLogged_Event logged;
+    logged.m_tick = tick;
+    logged.m_event = evt;
+    m_events.push_back(logged);
+
+    return 1;
+}
+
+void cInput_Log::Add_Elapsed_Ticks(uint32_t tick, uint32_t elapsed_ticks)
+{
+    if (!m_frame_times.empty() && m_frame_times.back().m_elapsed_ticks == elapsed_ticks) {
+        return;
+    }
+
+    cLogged_Frame_Time frame_time;
+    frame_time.m_tick = tick;
+    frame_time.m_elapsed_ticks = elapsed_ticks;
+    m_frame_times.push_back(frame_time);
+}
+
+void cInput_Log::Rewind(void)
+{
+    m_replay_pos = 0;
+    m_frame_time_pos = 0;
+}
+
+bool cInput_Log::Poll_Event(uint32_t tick, sf::Event& evt)
+{
+    if (m_replay_pos >= m_events.size() || m_events[m_replay_pos].m_tick > tick) {
+        return 0;
+    }
+
+    evt = m_events[m_replay_pos].m_event;
+    m_replay_pos++;
+    return 1;
+}
+
+bool cInput_Log::Get_Elapsed_Ticks(uint32_t tick, uint32_t& elapsed_ticks)
+{
+    // skip to the last change up to this tick
+    while (m_frame_time_pos + 1 < m_frame_times.size() && m_frame_times[m_frame_time_pos + 1].m_tick <= tick) {
+        m_frame_time_pos++;
+    }
+
+    if (m_frame_time_pos >= m_frame_times.size() || m_frame_times[m_frame_time_pos].m_tick > tick) {
+        return 0;
+    }
+
+    elapsed_ticks = m_frame_times[m_frame_time_pos].m_elapsed_ticks;
+    return 1;
+}
+
+bool cInput_Log::Is_Finished(void) const
+{
+    return m_replay_pos >= m_events.size();
+}
+
+uint32_t cInput_Log::Get_Last_Tick(void) const
+{
+    uint32_t last_tick = 0;
+
+    if (!m_events.empty()) {
+        last_tick = m_events.back().m_tick;
+    }
+    if (!m_frame_times.empty() && m_frame_times.back().m_tick > last_tick) {
+        last_tick = m_frame_times.back().m_tick;
+    }
+
+    return last_tick;
+}
+
+bool cInput_Log::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+{
+    if (count < 3 || !Is_Valid_Number(parts[0], 0)) {
+        cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error : ";
+        cerr << "expected <tick> <event> <value>" << endl;
+        m_parse_error = 1;
+        return 0;
+    }
+
+    const uint32_t tick = static_cast<uint32_t>(string_to_int(parts[0]));
+
+    // session values
+    if (parts[1] == "seed" && Is_Valid_Number(parts[2], 0)) {
+        m_seed = static_cast<uint32_t>(string_to_int64(parts[2]));
+        return 1;
+    }
+    else if (parts[1] == "elapsed" && Is_Valid_Number(parts[2], 0)) {
+        cLogged_Frame_Time frame_time;
+        frame_time.m_tick = tick;
+        frame_time.m_elapsed_ticks = static_cast<uint32_t>(string_to_int(parts[2]));
+        m_frame_times.push_back(frame_time);
+        return 1;
+    }
+
+    cLogged_Event logged;
+    logged.m_tick = tick;
+
+    if (parts[1] == "key_down" || parts[1] == "key_up") {
+        const int key = Get_Key(parts[2]);
+
+        if (key < 0) {
+            cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error : ";
+            cerr << parts[2] << " is not a valid key" << endl;
+            m_parse_error = 1;
+            return 0;
+        }
+
+        logged.m_event.type = parts[1] == "key_down" ? sf::Event::KeyPressed : sf::Event::KeyReleased;
+        logged.m_event.key.code = static_cast<sf::Keyboard::Key>(key);
+
+        const int modifiers = (count >= 4 && Is_Valid_Number(parts[3], 0)) ? string_to_int(parts[3]) : 0;
+
+        logged.m_event.key.alt = (modifiers & 1) != 0;
+        logged.m_event.key.control = (modifiers & 2) != 0;
+        logged.m_event.key.shift = (modifiers & 4) != 0;
+        logged.m_event.key.system = (modifiers & 8) != 0;
+    }
+    else if (parts[1] == "text" && Is_Valid_Number(parts[2], 0)) {
+        logged.m_event.type = sf::Event::TextEntered;
+        logged.m_event.text.unicode = static_cast<uint32_t>(string_to_int64(parts[2]));
+    }
+    else if ((parts[1] == "joy_down" || parts[1] == "joy_up") && Is_Valid_Number(parts[2], 0)) {
+        logged.m_event.type = parts[1] == "joy_down" ? sf::Event::JoystickButtonPressed : sf::Event::JoystickButtonReleased;
+        // the joystick id is set to the active one when replayed
+        logged.m_event.joystickButton.joystickId = 0;
+        logged.m_event.joystickButton.button = static_cast<unsigned int>(string_to_int(parts[2]));
+    }
+    else if (parts[1] == "joy_axis" && count >= 4 && Is_Valid_Number(parts[2], 0) && Is_Valid_Number(parts[3])) {
+        logged.m_event.type = sf::Event::JoystickMoved;
+        logged.m_event.joystickMove.joystickId = 0;
+        logged.m_event.joystickMove.axis = static_cast<sf::Joystick::Axis>(string_to_int(parts[2]));
+        logged.m_event.joystickMove.position = string_to_float(parts[3]);
+    }
+    else {
+        cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error : ";
+        cerr << "unknown input event " << parts[1] << endl;
+        m_parse_error = 1;
+        return 0;
+    }
+
+    m_events.push_back(logged);
+    return 1;
+}
+
+int cInput_Log::Get_Key(const std::string& str) const
+{
+    if (str == "left") {
+        return pPreferences->m_key_left;
+    }
+    else if (str == "right") {
+        return pPreferences->m_key_right;
+    }
+    else if (str == "up") {
+        return pPreferences->m_key_up;
+    }
+    else if (str == "down") {
+        return pPreferences->m_key_down;
+    }
+    else if (str == "jump") {
+        return pPreferences->m_key_jump;
+    }
+    else if (str == "shoot") {
+        return pPreferences->m_key_shoot;
+    }
+    else if (str == "action") {
+        return pPreferences->m_key_action;
+    }
+    else if (str == "item") {
+        return pPreferences->m_key_item;
+    }
+    else if (Is_Valid_Number(str, 0)) {
+        const int key = string_to_int(str);
+
+        if (key >= 0 && key < sf::Keyboard::KeyCount) {
+            return key;
+        }
+    }
+
+    return -1;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,117 @@
+/***************************************************************************
+ * input_log.hpp  -  Per-tick log of input events
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_INPUT_LOG_HPP
+#define TSC_INPUT_LOG_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/file_parser.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cInput_Log *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Keyboard and joystick events ordered by the game tick they happened in
+     *
+     * The file format has one entry per line :
+     * <tick> key_down|key_up <key> [<modifiers>]
+     * <tick> text <unicode character>
+     * <tick> joy_down|joy_up <button>
+     * <tick> joy_axis <axis> <position>
+     * <tick> elapsed <milliseconds>
+     * <tick> seed <random seed>
+     * Lines starting with # are comments. A key is either the SFML key code
+     * or one of the player action names left, right, up, down, jump, shoot,
+     * action and item which use the keys from the preferences. The modifiers
+     * are a bitmask of 1 alt, 2 control, 4 shift and 8 system.
+     * Elapsed sets the frame time from this tick on and is only written
+     * when it changes.
+    */
+    class cInput_Log : public cFile_parser {
+    public:
+        cInput_Log(void);
+        virtual ~cInput_Log(void);
+
+        // Remove all events and rewind
+        void Clear(void);
+        /* Load the events from the given file
+         * returns false if the file could not be read or has invalid lines
+        */
+        bool Load_From_File(const boost::filesystem::path& filename);
+        /* Save the events to the given file
+         * returns false if the file could not be written
+        */
+        bool Save_To_File(const boost::filesystem::path& filename) const;
+
+        /* Add the event if it is a keyboard, text or joystick event
+         * returns true if it was added
+        */
+        bool Add_Event(uint32_t tick, const sf::Event& evt);
+        // Add the frame time if it changed since the last added one
+        void Add_Elapsed_Ticks(uint32_t tick, uint32_t elapsed_ticks);
+
+        // Start returning events from the beginning again
+        void Rewind(void);
+        /* Get the next event of the given tick
+         * returns false if no further event happened up to this tick
+        */
+        bool Poll_Event(uint32_t tick, sf::Event& evt);
+        /* Get the frame time valid for the given tick
+         * returns false if none was logged up to this tick
+        */
+        bool Get_Elapsed_Ticks(uint32_t tick, uint32_t& elapsed_ticks);
+        // Return true if all events were returned
+        bool Is_Finished(void) const;
+        // Return the tick of the last event
+        uint32_t Get_Last_Tick(void) const;
+
+        // Handle one tokenized line
+        virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
+
+        struct cLogged_Event {
+            uint32_t m_tick;
+            sf::Event m_event;
+        };
+
+        struct cLogged_Frame_Time {
+            uint32_t m_tick;
+            uint32_t m_elapsed_ticks;
+        };
+
+        typedef vector<cLogged_Event> LoggedEventList;
+        LoggedEventList m_events;
+        typedef vector<cLogged_Frame_Time> LoggedFrameTimeList;
+        LoggedFrameTimeList m_frame_times;
+
+        // random seed of the session
+        uint32_t m_seed;
+
+    private:
+        // Return the key for an action name or key code or -1 if unknown
+        int Get_Key(const std::string& str) const;
+
+        // next event to return
+        LoggedEventList::size_type m_replay_pos;
+        // next frame time to return
+        LoggedFrameTimeList::size_type m_frame_time_pos;
+        // set if a line could not be parsed
+        bool m_parse_error;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
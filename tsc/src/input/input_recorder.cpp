@@ -0,0 +1,201 @@
+/***************************************************************************
+ * input_recorder.cpp  -  Recording and replaying of the input events
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/framerate.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../video/video.hpp"
+#include "../input/keyboard.hpp"
+#include "../input/joystick.hpp"
+#include "../input/input_recorder.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cInput_Recorder *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Recorder::cInput_Recorder(void)
+{
+    m_mode = INPUT_RECORDER_OFF;
+    m_tick = 0;
+    m_next_tick = 0;
+}
+
+cInput_Recorder::~cInput_Recorder(void)
+{
+    Stop();
+}
+
+void cInput_Recorder::Start_Recording(const fs::path& filename)
+{
+    Stop();
+
+    m_log.Clear();
+    m_log.m_seed = static_cast<uint32_t>(time(NULL));
+    srand(m_log.m_seed);
+
+    m_filename = filename;
+    m_tick = 0;
+    m_next_tick = 0;
+    m_mode = INPUT_RECORDER_RECORD;
+
+    // the held keys are taken from the events as when replaying
+    pKeyboard->Set_Event_Key_States(1);
+    pJoystick->Set_Event_Button_States(1);
+
+    cout << "Recording input to " << path_to_utf8(m_filename) << endl;
+}
+
+bool cInput_Recorder::Start_Replay(const fs::path& filename)
+{
+    Stop();
+
+    if (!m_log.Load_From_File(filename)) {
+        cerr << "Error : Could not load input log " << path_to_utf8(filename) << endl;
+        return 0;
+    }
+
+    srand(m_log.m_seed);
+
+    m_filename = filename;
+    m_tick = 0;
+    m_next_tick = 0;
+    m_mode = INPUT_RECORDER_REPLAY;
+
+    pKeyboard->Set_Event_Key_States(1);
+    pJoystick->Set_Event_Button_States(1);
+
+    cout << "Replaying input from " << path_to_utf8(m_filename) << endl;
+    return 1;
+}
+
+void cInput_Recorder::Stop(void)
+{
+    if (m_mode == INPUT_RECORDER_OFF) {
+        return;
+    }
+
+    if (m_mode == INPUT_RECORDER_RECORD) {
+        m_log.Save_To_File(m_filename);
+    }
+    else {
+        cout << "Input replay finished after " << m_tick << " ticks" << endl;
+    }
+
+    m_mode = INPUT_RECORDER_OFF;
+    m_log.Clear();
+
+    // back to the real keyboard and joystick
+    pKeyboard->Set_Event_Key_States(0);
+    pJoystick->Set_Event_Button_States(0);
+}
+
+void cInput_Recorder::Next_Tick(void)
+{
+    if (m_mode == INPUT_RECORDER_OFF) {
+        return;
+    }
+
+    m_tick = m_next_tick;
+    m_next_tick++;
+
+    if (m_mode == INPUT_RECORDER_RECORD) {
+        m_log.Add_Elapsed_Ticks(m_tick, pFramerate->m_elapsed_ticks);
+    }
+    else {
+        // all events replayed
+        if (m_log.Is_Finished() && m_tick > m_log.Get_Last_Tick()) {
+            Stop();
+            return;
+        }
+
+        uint32_t elapsed_ticks;
+
+        if (m_log.Get_Elapsed_Ticks(m_tick, elapsed_ticks)) {
+            pFramerate->Set_Elapsed_Ticks(elapsed_ticks);
+        }
+    }
+}
+
+bool cInput_Recorder::Poll_Event(sf::Event& evt)
+{
+    if (m_mode == INPUT_RECORDER_REPLAY) {
+        // window events still get through but live input is ignored
+        while (pVideo->PollEvent(evt)) {
+            if (!Is_Logged_Event(evt)) {
+                return 1;
+            }
+        }
+
+        if (!m_log.Poll_Event(m_tick, evt)) {
+            return 0;
+        }
+
+        // replay on the active joystick
+        if (evt.type == sf::Event::JoystickButtonPressed || evt.type == sf::Event::JoystickButtonReleased) {
+            evt.joystickButton.joystickId = pJoystick->m_current_joystick;
+        }
+        else if (evt.type == sf::Event::JoystickMoved) {
+            evt.joystickMove.joystickId = pJoystick->m_current_joystick;
+        }
+
+        return 1;
+    }
+
+    if (!pVideo->PollEvent(evt)) {
+        return 0;
+    }
+
+    if (m_mode == INPUT_RECORDER_RECORD && Is_Logged_Event(evt)) {
+        // only the active joystick is handled
+        if ((evt.type == sf::Event::JoystickButtonPressed || evt.type == sf::Event::JoystickButtonReleased) && evt.joystickButton.joystickId != pJoystick->m_current_joystick) {
+            return 1;
+        }
+        if (evt.type == sf::Event::JoystickMoved && evt.joystickMove.joystickId != pJoystick->m_current_joystick) {
+            return 1;
+        }
+
+        m_log.Add_Event(m_tick, evt);
+    }
+
+    return 1;
+}
+
+bool cInput_Recorder::Is_Logged_Event(const sf::Event& evt) const
+{
+    switch (evt.type) {
+    case sf::Event::KeyPressed:
+    case sf::Event::KeyReleased:
+    case sf::Event::TextEntered:
+    case sf::Event::JoystickButtonPressed:
+    case sf::Event::JoystickButtonReleased:
+    case sf::Event::JoystickMoved:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cInput_Recorder* pInput_Recorder = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,88 @@
+/***************************************************************************
+ * input_recorder.hpp  -  Recording and replaying of the input events
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_INPUT_RECORDER_HPP
+#define TSC_INPUT_RECORDER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../input/input_log.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cInput_Recorder *** *** *** *** *** *** *** *** *** *** *** */
+
+    enum InputRecorderMode {
+        INPUT_RECORDER_OFF = 0,
+        INPUT_RECORDER_RECORD = 1,
+        INPUT_RECORDER_REPLAY = 2
+    };
+
+    /* Sits between the window events and the input handlers
+     *
+     * When recording, the keyboard, text and joystick events are logged
+     * together with the frame time and the random seed. When replaying,
+     * these events are read from the log instead of the window and the
+     * logged frame time is used, so the same session is played again
+     * as long as the game data and the preferences are the same.
+    */
+    class cInput_Recorder {
+    public:
+        cInput_Recorder(void);
+        ~cInput_Recorder(void);
+
+        // Start recording into the given file which is written by Stop()
+        void Start_Recording(const boost::filesystem::path& filename);
+        /* Start replaying the given file
+         * returns false if it could not be loaded
+        */
+        bool Start_Replay(const boost::filesystem::path& filename);
+        // Stop and save the recording if any
+        void Stop(void);
+
+        /* Start the next game tick
+         * records or applies the frame time
+        */
+        void Next_Tick(void);
+        /* Get the next event
+         * use this instead of cVideo::PollEvent for events that reach the game handlers
+        */
+        bool Poll_Event(sf::Event& evt);
+
+        // current mode
+        InputRecorderMode m_mode;
+
+    private:
+        // Return true if the event is recorded and replayed
+        bool Is_Logged_Event(const sf::Event& evt) const;
+
+        cInput_Log m_log;
+        // log file
+        boost::filesystem::path m_filename;
+        // current tick
+        uint32_t m_tick;
+        // next tick
+        uint32_t m_next_tick;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Input Recorder
+    extern cInput_Recorder* pInput_Recorder;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -37,6 +37,7 @@ const float cJoystick::m_joystick_neutral_bound = 20.0f;
 cJoystick::cJoystick(void)
 {
     m_debug = 0;
+    m_event_button_states = 0;
 
     Reset_keys();
 
@@ -155,6 +156,8 @@ void cJoystick::Reset_keys(void)
     m_right = false;
     m_up = false;
     m_down = false;
+
+    std::fill(m_buttons_down, m_buttons_down + sf::Joystick::ButtonCount, false);
 }
 
 void cJoystick::Handle_Motion(const sf::Event& evt)
@@ -343,6 +346,10 @@ bool cJoystick::Handle_Button_Down_Event(const sf::Event& evt)
         return 0;
     }
 
+    if (evt.joystickButton.button < sf::Joystick::ButtonCount) {
+        m_buttons_down[evt.joystickButton.button] = 1;
+    }
+
     // handle button in the current mode
     if (Game_Mode == MODE_LEVEL) {
         // processed by the level
@@ -421,6 +428,10 @@ bool cJoystick::Handle_Button_Up_Event(const sf::Event& evt)
         return 0;
     }
 
+    if (evt.joystickButton.button < sf::Joystick::ButtonCount) {
+        m_buttons_down[evt.joystickButton.button] = 0;
+    }
+
     // handle button in the current mode
     if (Game_Mode == MODE_LEVEL) {
         // processed by the level
@@ -501,11 +512,21 @@ vector<std::string> cJoystick::Get_Names(void) const
 
 bool cJoystick::Button(unsigned int num)
 {
-    if (pPreferences->m_joy_enabled && sf::Joystick::isButtonPressed(m_current_joystick, num)) {
-        return 1;
+    if (!pPreferences->m_joy_enabled) {
+        return 0;
     }
 
-    return 0;
+    if (m_event_button_states) {
+        return num < sf::Joystick::ButtonCount && m_buttons_down[num];
+    }
+
+    return sf::Joystick::isButtonPressed(m_current_joystick, num);
+}
+
+void cJoystick::Set_Event_Button_States(bool enable)
+{
+    m_event_button_states = enable;
+    std::fill(m_buttons_down, m_buttons_down + sf::Joystick::ButtonCount, false);
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
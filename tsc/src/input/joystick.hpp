@@ -39,6 +39,11 @@ namespace TSC {
         bool m_up;
         bool m_down;
 
+        // if set Button() uses m_buttons_down
+        bool m_event_button_states;
+        // button state from the received events
+        bool m_buttons_down[sf::Joystick::ButtonCount];
+
     public:
         cJoystick(void);
         ~cJoystick(void);
@@ -95,6 +100,11 @@ namespace TSC {
         // check if the given button is pushed
         bool Button(unsigned int button);
 
+        /* Use the button state from the received button events instead of the real joystick
+         * used when the input is replayed from an input log
+        */
+        void Set_Event_Button_States(bool enable);
+
         // SFML current opened joystick
         unsigned int m_current_joystick;
 
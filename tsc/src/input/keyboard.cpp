@@ -40,7 +40,8 @@ namespace TSC {
 
 cKeyboard::cKeyboard(void)
 {
-
+    m_event_key_states = 0;
+    Reset_Keys();
 }
 
 cKeyboard::~cKeyboard(void)
@@ -48,6 +49,39 @@ cKeyboard::~cKeyboard(void)
 
 }
 
+bool cKeyboard::Is_Key_Down(sf::Keyboard::Key key) const
+{
+    if (m_event_key_states) {
+        if (key < 0 || key >= sf::Keyboard::KeyCount) {
+            return 0;
+        }
+
+        return m_keys_down[key];
+    }
+
+    return sf::Keyboard::isKeyPressed(key);
+}
+
+void cKeyboard::Set_Event_Key_States(bool enable)
+{
+    m_event_key_states = enable;
+    Reset_Keys();
+}
+
+void cKeyboard::Reset_Keys(void)
+{
+    std::fill(m_keys_down, m_keys_down + sf::Keyboard::KeyCount, false);
+}
+
+void cKeyboard::Set_Key_State(sf::Keyboard::Key key, bool down)
+{
+    if (key < 0 || key >= sf::Keyboard::KeyCount) {
+        return;
+    }
+
+    m_keys_down[key] = down;
+}
+
 bool cKeyboard::CEGUI_Handle_Key_Up(sf::Keyboard::Key key) const
 {
     // inject the scancode directly
@@ -61,6 +95,9 @@ bool cKeyboard::CEGUI_Handle_Key_Up(sf::Keyboard::Key key) const
 
 bool cKeyboard::Key_Up(const sf::Event& evt)
 {
+    // the key is released even if the event is not processed
+    Set_Key_State(evt.key.code, 0);
+
     // input was processed by the gui system
     if (CEGUI_Handle_Key_Up(evt.key.code)) {
         return 1;
@@ -102,6 +139,9 @@ bool cKeyboard::CEGUI_Handle_Key_Down(sf::Keyboard::Key key) const
 
 bool cKeyboard::Key_Down(const sf::Event& evt)
 {
+    // the key is pressed even if the event is not processed
+    Set_Key_State(evt.key.code, 1);
+
     // input was processed by the gui system
     if (CEGUI_Handle_Key_Down(evt.key.code)) {
         return 1;
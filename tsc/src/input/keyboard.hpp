@@ -39,9 +39,20 @@ namespace TSC {
             return mrb_obj_value(Data_Wrap_Struct(p_state, mrb_class_get(p_state, "InputClass"), &Scripting::rtTSC_Scriptable, this));
         }
 
+        /* Check if the given key is pressed
+         * uses the state from the received key events if m_event_key_states is set
+        */
+        bool Is_Key_Down(sf::Keyboard::Key key) const;
+        /* Use the key state from the received key events instead of the real keyboard
+         * used when the input is replayed from an input log
+        */
+        void Set_Event_Key_States(bool enable);
+        // Release all keys pressed by events
+        void Reset_Keys(void);
+
         // Check the state of the Shift and Ctrl keys.
-        inline bool Is_Shift_Down(){ return sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift); }
-        inline bool Is_Ctrl_Down(){ return sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) || sf::Keyboard::isKeyPressed(sf::Keyboard::RControl); }
+        inline bool Is_Shift_Down(){ return Is_Key_Down(sf::Keyboard::LShift) || Is_Key_Down(sf::Keyboard::RShift); }
+        inline bool Is_Ctrl_Down(){ return Is_Key_Down(sf::Keyboard::LControl) || Is_Key_Down(sf::Keyboard::RControl); }
 
         /* CEGUI Key Up handler
          * returns true if CEGUI processed the given key up event
@@ -75,6 +86,15 @@ namespace TSC {
 
         // Translate a SFMLKey to the proper CEGUI::Key
         CEGUI::Key::Scan SFMLKey_to_CEGUIKey(const sf::Keyboard::Key key) const;
+
+    private:
+        // Set the event state of the given key
+        void Set_Key_State(sf::Keyboard::Key key, bool down);
+
+        // if set Is_Key_Down() uses m_keys_down
+        bool m_event_key_states;
+        // key state from the received events
+        bool m_keys_down[sf::Keyboard::KeyCount];
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
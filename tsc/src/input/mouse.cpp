@@ -378,8 +378,9 @@ cObjectCollision* cMouseCursor::Get_First_Editor_Collsion(float px /* = 0.0f */,
 
 cObjectCollision* cMouseCursor::Get_First_Mouse_Collision(const GL_rect& mouse_rect)
 {
+    // objects below the mouse sorted from editor z position
     cSprite_List sprite_objects;
-    m_sprite_manager->Get_Objects_sorted(sprite_objects, 1, 1);
+    m_sprite_manager->Get_Editor_Objects(sprite_objects, mouse_rect, 1);
 
     // check objects
     for (cSprite_List::reverse_iterator itr = sprite_objects.rbegin(); itr != sprite_objects.rend(); ++itr) {
@@ -951,8 +952,12 @@ bool cMouseCursor::Get_Snap_Pos(GL_point& new_pos, int snap, cSelectedObject* sr
     int num_snap_obj = 0;
     cSprite* snap_obj = NULL;
 
+    // objects in snap range
+    cSprite_List snap_objects;
+    m_sprite_manager->Get_Editor_Objects(snap_objects, full_snap_rect);
+
     // check objects for overlap
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+    for (cSprite_List::iterator itr = snap_objects.begin(); itr != snap_objects.end(); ++itr) {
         cSprite* obj = (*itr);
 
         // don't check selected objects
@@ -1429,8 +1434,12 @@ void cMouseCursor::Update_Selection(void)
             Clear_Selected_Objects();
         }
 
+        // objects with the start rect in the selection
+        cSprite_List sprite_objects;
+        m_sprite_manager->Get_Editor_Objects(sprite_objects, rect);
+
         // add selected objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        for (cSprite_List::iterator itr = sprite_objects.begin(); itr != sprite_objects.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // don't check spawned/destroyed objects
@@ -1438,11 +1447,6 @@ void cMouseCursor::Update_Selection(void)
                 continue;
             }
 
-            // if it doesn't collide with the rect
-            if (!rect.Intersects(obj->m_rect)) {
-                continue;
-            }
-
             Add_Selected_Object(obj, 1);
         }
 
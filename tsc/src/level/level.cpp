@@ -200,7 +200,7 @@ bool cLevel::New(std::string levelname)
     return 0;
 }
 
-cLevel* cLevel::Load_From_File(fs::path filename)
+cLevel* cLevel::Load_From_File(fs::path filename, cLevel_Snapshot* p_snapshot /* = NULL */)
 {
     if (filename.empty())
         throw(InvalidLevelError("Empty level filename!"));
@@ -209,36 +209,49 @@ cLevel* cLevel::Load_From_File(fs::path filename)
         throw (InvalidLevelError(msg));
     }
 
-    // This is our loader
-    cLevelLoader loader;
-
-    // supported level format
-    if (filename.extension() == fs::path(".tsclvl")  || filename.extension() == fs::path(".smclvl")) {
-        loader.parse_file(filename);
-    }
-    else { // old, unsupported level format
+    // old, unsupported level format
+    if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) {
         gp_hud->Set_Text(_("Unsupported Level format : ") + (const std::string)path_to_utf8(filename));
         return NULL;
     }
 
-    // Our level
-    cLevel* p_level = loader.Get_Level();
+    cLevel_Snapshot snapshot;
 
-    // FIXME: Move this into cLevelLoader::on_end_document()
-    /* late initialization
-     * needed to create links to other objects
+    if (!p_snapshot) {
+        p_snapshot = &snapshot;
+    }
+
+    /* Parse all elements first so the images can be decoded in parallel.
+     * The sprites are then created in file order as their textures and
+     * the sprite manager are only usable from this thread.
     */
-    for (cSprite_List::iterator itr = p_level->m_sprite_manager->objects.begin(); itr != p_level->m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    cLevelLoader::Record_File(filename, *p_snapshot);
 
-        obj->Init_Links();
+    cLevel* p_level = NULL;
+
+    {
+        // images of objects which were not created are freed at the end of the scope
+        cImage_Preload preload(p_snapshot->Get_Image_Files());
+        p_level = cLevelLoader::Load_From_Snapshot(*p_snapshot);
     }
 
+    // FIXME: Move this into cLevelLoader::on_end_document()
+    p_level->Init_Links();
+
     debug_print("Loaded level: %s\n", path_to_utf8(p_level->m_level_filename).c_str());
 
     return p_level;
 }
 
+void cLevel::Init_Links(void)
+{
+    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        obj->Init_Links();
+    }
+}
+
 void cLevel::Unload(bool delayed /* = 0 */)
 {
     if (delayed) {
@@ -290,6 +303,9 @@ void cLevel::Unload(bool delayed /* = 0 */)
      * do this at last
     */
     m_sprite_manager->Delete_All();
+
+    // the collisions of the next level may need less memory
+    Clear_Collision_Free_Lists();
 }
 
 fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
@@ -370,6 +386,8 @@ fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
 
     // Write to file (raises xmlpp::exception on write error)
     doc.write_to_file_formatted(Glib::filename_from_utf8(path_to_utf8(filename)));
+    // the next load has to read the file again
+    pLevel_Manager->Delete_Snapshot(filename);
     debug_print("Wrote level file '%s'.\n", path_to_utf8(filename).c_str());
 
     return filename;
@@ -632,12 +650,10 @@ void cLevel::Update(void)
     // if level-editor enabled
     else {
         // only update particle emitters
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            cSprite* obj = (*itr);
+        const cSprite_List& emitters = m_sprite_manager->Get_Objects_by_Type(TYPE_PARTICLE_EMITTER);
 
-            if (obj->m_type == TYPE_PARTICLE_EMITTER) {
-                obj->Update();
-            }
+        for (cSprite_List::const_iterator itr = emitters.begin(); itr != emitters.end(); ++itr) {
+            (*itr)->Update();
         }
     }
 }
@@ -710,7 +726,7 @@ void cLevel::Draw_Layer_2(LevelDrawType type /* = LVL_DRAW */)
 void cLevel::Process_Input(void)
 {
     // Omega Mode
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::O) && sf::Keyboard::isKeyPressed(sf::Keyboard::M) && !editor_enabled) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::O) && pKeyboard->Is_Key_Down(sf::Keyboard::M) && !editor_enabled) {
         if (m_cheat_counter > 50.0f) {
             if (pLevel_Player->m_omega_mode) {
                 gp_hud->Set_Text(_("Omega Mode disabled"));
@@ -727,7 +743,7 @@ void cLevel::Process_Input(void)
         }
     }
     // Set Small state
-    else if (sf::Keyboard::isKeyPressed(sf::Keyboard::K) && sf::Keyboard::isKeyPressed(sf::Keyboard::I) && sf::Keyboard::isKeyPressed(sf::Keyboard::D) && !editor_enabled) {
+    else if (pKeyboard->Is_Key_Down(sf::Keyboard::K) && pKeyboard->Is_Key_Down(sf::Keyboard::I) && pKeyboard->Is_Key_Down(sf::Keyboard::D) && !editor_enabled) {
         gp_hud->Set_Text(_("Kid cheat activated"));
         pLevel_Player->Set_Type(ALEX_SMALL, 0);
     }
@@ -1180,6 +1196,11 @@ void cLevel::Reinitialize_MRuby_Interpreter()
     // Run the mruby code associated with this level (this sets up
     // all the event handlers the user wants to register)
     m_mruby->Run_Code(m_script, "(level script)");
+
+    // Loading is a safe point for a pause. From now on the
+    // collection only runs in the idle time of the frames.
+    m_mruby->Get_GC_Scheduler().Full_Collect();
+    m_mruby->Get_GC_Scheduler().Set_Active(1);
 }
 
 void cLevel::Pause_All_Timers(bool pause)
@@ -34,7 +34,8 @@ namespace TSC {
     public:
 
         /// Loads a level from the given file.
-        static cLevel* Load_From_File(boost::filesystem::path filename);
+        /// The parsed elements are recorded into the snapshot if given.
+        static cLevel* Load_From_File(boost::filesystem::path filename, cLevel_Snapshot* p_snapshot = NULL);
 
         cLevel(void);
         virtual ~cLevel(void);
@@ -61,6 +62,10 @@ namespace TSC {
         // Reset settings data
         void Reset_Settings(void);
 
+        /* Let the loaded sprites create their links to other objects
+         * needed once after all sprites are loaded
+        */
+        void Init_Links(void);
         // Initialize level elements on level creation/loading
         void Init(void);
         // Set this sprite manager active
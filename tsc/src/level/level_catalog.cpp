@@ -0,0 +1,425 @@
+/***************************************************************************
+ * level_catalog.cpp  -  Cached information about all level files
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/math/utilities.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../level/level.hpp"
+#include "../level/level_catalog.hpp"
+
+using namespace TSC;
+
+namespace fs = boost::filesystem;
+
+/* Reads the level information without creating the sprites
+ * The information and settings elements are at the start of the file,
+ * so the caller stops feeding the file when Is_Header_Done() is set.
+*/
+class cLevel_Info_Parser : public xmlpp::SaxParser {
+public:
+    cLevel_Info_Parser(cLevel_Catalog_Entry& entry)
+        : xmlpp::SaxParser(), m_entry(entry)
+    {
+        m_header_done = 0;
+    }
+
+    // Return true if the settings element was read
+    bool Is_Header_Done(void) const
+    {
+        return m_header_done;
+    }
+
+protected:
+    virtual void on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
+    {
+        if (name != "property" && name != "Property") {
+            return;
+        }
+
+        std::string key;
+        std::string value;
+
+        for (xmlpp::SaxParser::AttributeList::const_iterator iter = properties.begin(); iter != properties.end(); iter++) {
+            if (iter->name == "name")
+                key = iter->value;
+            else if (iter->name == "value")
+                value = iter->value;
+        }
+
+        m_properties[key] = value;
+    }
+
+    virtual void on_end_element(const Glib::ustring& name)
+    {
+        // collected until the surrounding element ends
+        if (name == "property" || name == "Property") {
+            return;
+        }
+
+        if (name == "information" || name == "settings") {
+            if (m_properties.count("lvl_author"))
+                m_entry.m_author = m_properties["lvl_author"];
+            if (m_properties.count("lvl_description"))
+                m_entry.m_description = xml_string_to_string(m_properties["lvl_description"]);
+            if (m_properties.count("lvl_difficulty"))
+                m_entry.m_difficulty = string_to_int(m_properties["lvl_difficulty"]);
+            if (m_properties.count("lvl_music"))
+                m_entry.m_music = m_properties["lvl_music"];
+            if (m_properties.count("lvl_land_type"))
+                m_entry.m_land_type = Get_Level_Land_Type_Id(m_properties["lvl_land_type"]);
+
+            if (name == "settings") {
+                m_header_done = 1;
+            }
+        }
+
+        m_properties.clear();
+    }
+
+private:
+    cLevel_Catalog_Entry& m_entry;
+    std::map<std::string, std::string> m_properties;
+    // set if the settings element was read
+    bool m_header_done;
+};
+
+const int cLevel_Catalog::m_file_version = 1;
+const size_t cLevel_Catalog::m_header_chunk_size = 4096;
+
+cLevel_Catalog::cLevel_Catalog(void)
+    : cFile_parser()
+{
+    m_loaded = 0;
+    m_file_loaded_version = 0;
+    m_parse_error = 0;
+}
+
+cLevel_Catalog::~cLevel_Catalog(void)
+{
+    //
+}
+
+void cLevel_Catalog::Update(void)
+{
+    const fs::path filename = pResource_Manager->Get_User_Level_Catalog_File();
+    bool changed = 0;
+
+    if (!m_loaded) {
+        m_loaded = 1;
+
+        if (!Load_From_File(filename)) {
+            changed = 1;
+        }
+    }
+
+    EntryMap old_entries;
+
+    for (EntryList::const_iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        old_entries[itr->m_path] = *itr;
+    }
+
+    m_entries.clear();
+
+    unsigned int read_count = Update_Directory(pResource_Manager->Get_Game_Level_Directory(), 0, old_entries);
+    read_count += Update_Directory(pResource_Manager->Get_User_Level_Directory(), 1, old_entries);
+
+    // the remaining entries were deleted
+    if (read_count > 0 || !old_entries.empty()) {
+        changed = 1;
+    }
+
+    if (read_count > 0) {
+        debug_print("Level catalog : read %u level files\n", read_count);
+    }
+
+    if (changed) {
+        Save_To_File(filename);
+    }
+}
+
+bool cLevel_Catalog::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+{
+    if (parts[0].compare("version") == 0) {
+        if (count != 2 || !Is_Valid_Number(parts[1], 0)) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        m_file_loaded_version = string_to_int(parts[1]);
+    }
+    else if (parts[0].compare("level") == 0) {
+        if (count != 10 || (parts[1] != "game" && parts[1] != "user")) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        // write time, difficulty and object count
+        if (!Is_Valid_Number(parts[3], 0) || !Is_Valid_Number(parts[4], 0) || !Is_Valid_Number(parts[6], 0)) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        // land type name as written by Save_To_File()
+        if (Get_Level_Land_Type_Name(Get_Level_Land_Type_Id(parts[5])) != parts[5]) {
+            m_parse_error = 1;
+            return 0;
+        }
+
+        cLevel_Catalog_Entry entry;
+        entry.m_user = parts[1] == "user";
+
+        if (entry.m_user) {
+            entry.m_path = pResource_Manager->Get_User_Level_Directory() / utf8_to_path(Unescape(parts[2]));
+        }
+        else {
+            entry.m_path = pResource_Manager->Get_Game_Level_Directory() / utf8_to_path(Unescape(parts[2]));
+        }
+
+        entry.m_name = path_to_utf8(entry.m_path.stem());
+        entry.m_write_time = static_cast<std::time_t>(string_to_int64(parts[3]));
+        entry.m_difficulty = string_to_int(parts[4]);
+        entry.m_land_type = Get_Level_Land_Type_Id(parts[5]);
+        entry.m_object_count = string_to_int(parts[6]);
+        entry.m_author = Unescape(parts[7]);
+        entry.m_music = Unescape(parts[8]);
+        entry.m_description = Unescape(parts[9]);
+
+        m_entries.push_back(entry);
+    }
+    else {
+        m_parse_error = 1;
+        return 0;
+    }
+
+    return 1;
+}
+
+unsigned int cLevel_Catalog::Update_Directory(const fs::path& dir, bool user, EntryMap& old_entries)
+{
+    // .tsclvl is the new TSC level format, but .smclvl is listed for reverse compatibility
+    std::vector<fs::path> lvl_files = Get_Directory_Files(dir, ".tsclvl", false, false);
+    std::vector<fs::path> lvl_files2 = Get_Directory_Files(dir, ".smclvl", false, false);
+    lvl_files.insert(lvl_files.end(), lvl_files2.begin(), lvl_files2.end());
+
+    std::vector<cLevel_Catalog_Entry> entries;
+    unsigned int read_count = 0;
+
+    for (std::vector<fs::path>::const_iterator path_itr = lvl_files.begin(); path_itr != lvl_files.end(); ++path_itr) {
+        const fs::path& lvl_path = *path_itr;
+        boost::system::error_code ec;
+        const std::time_t write_time = fs::last_write_time(lvl_path, ec);
+
+        if (ec) {
+            continue;
+        }
+
+        EntryMap::iterator itr = old_entries.find(lvl_path);
+
+        if (itr != old_entries.end()) {
+            // not modified
+            if (itr->second.m_write_time == write_time && itr->second.m_user == user) {
+                entries.push_back(itr->second);
+                old_entries.erase(itr);
+                continue;
+            }
+
+            old_entries.erase(itr);
+        }
+
+        cLevel_Catalog_Entry entry;
+        entry.m_name = path_to_utf8(lvl_path.stem());
+        entry.m_path = lvl_path;
+        entry.m_write_time = write_time;
+        entry.m_user = user;
+        entry.m_difficulty = 0;
+        entry.m_land_type = LLT_UNDEFINED;
+        entry.m_object_count = 0;
+
+        // still listed as it may load anyway
+        if (!Read_Level_Info(entry)) {
+            std::cerr << "Warning: Could not read level information from " << path_to_utf8(lvl_path) << std::endl;
+        }
+
+        entries.push_back(entry);
+        read_count++;
+    }
+
+    std::sort(
+        entries.begin(),
+        entries.end(), [](const cLevel_Catalog_Entry& a, const cLevel_Catalog_Entry& b) {
+                           return a.m_name < b.m_name;
+                       });
+
+    m_entries.insert(m_entries.end(), entries.begin(), entries.end());
+
+    return read_count;
+}
+
+bool cLevel_Catalog::Read_Level_Info(cLevel_Catalog_Entry& entry) const
+{
+    fs::ifstream ifs(entry.m_path, std::ios::in | std::ios::binary);
+
+    if (!ifs) {
+        return 0;
+    }
+
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    const std::string data = ss.str();
+
+    cLevel_Info_Parser parser(entry);
+
+    try {
+        // only parse up to the end of the settings
+        for (size_t pos = 0; pos < data.size() && !parser.Is_Header_Done(); pos += m_header_chunk_size) {
+            parser.parse_chunk(Glib::ustring(data.substr(pos, m_header_chunk_size)));
+        }
+
+        if (!parser.Is_Header_Done()) {
+            parser.finish_chunk_parsing();
+        }
+    }
+    catch (const std::exception& e) {
+        debug_print("Reading level %s failed : %s\n", entry.m_name.c_str(), e.what());
+        return 0;
+    }
+
+    entry.m_object_count = Count_Level_Objects(data);
+
+    return 1;
+}
+
+unsigned int cLevel_Catalog::Count_Level_Objects(const std::string& data)
+{
+    unsigned int count = 0;
+    size_t pos = data.find('<');
+
+    while (pos != std::string::npos) {
+        size_t name_end = pos + 1;
+
+        while (name_end < data.size() && (isalnum(static_cast<unsigned char>(data[name_end])) || data[name_end] == '_')) {
+            name_end++;
+        }
+
+        // start tag followed by its properties
+        if (name_end > pos + 1 && name_end < data.size() && (data[name_end] == '>' || isspace(static_cast<unsigned char>(data[name_end])))) {
+            const std::string name = data.substr(pos + 1, name_end - pos - 1);
+
+            if (name != "information" && name != "settings" && name != "background" && name != "player" && name != "music" && cLevel::Is_Level_Object_Element(name)) {
+                count++;
+            }
+        }
+
+        pos = data.find('<', name_end);
+    }
+
+    return count;
+}
+
+bool cLevel_Catalog::Load_From_File(const fs::path& filename)
+{
+    if (!File_Exists(filename)) {
+        return 0;
+    }
+
+    m_entries.clear();
+    m_file_loaded_version = 0;
+    m_parse_error = 0;
+
+    if (!Parse(filename) || m_parse_error || m_file_loaded_version != m_file_version) {
+        m_entries.clear();
+        return 0;
+    }
+
+    return 1;
+}
+
+void cLevel_Catalog::Save_To_File(const fs::path& filename) const
+{
+    fs::ofstream ofs(filename, std::ios::out | std::ios::trunc);
+
+    if (!ofs) {
+        std::cerr << "Warning: Could not save the level catalog to " << path_to_utf8(filename) << std::endl;
+        return;
+    }
+
+    ofs << "# Level files of the game and user level directories" << std::endl;
+    ofs << "version " << m_file_version << std::endl;
+
+    for (EntryList::const_iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        const cLevel_Catalog_Entry& entry = *itr;
+
+        ofs << "level " << (entry.m_user ? "user" : "game") << " " << Escape(path_to_utf8(entry.m_path.filename()));
+        ofs << " " << static_cast<int64_t>(entry.m_write_time) << " " << entry.m_difficulty << " " << Get_Level_Land_Type_Name(entry.m_land_type) << " " << entry.m_object_count;
+        ofs << " " << Escape(entry.m_author) << " " << Escape(entry.m_music) << " " << Escape(entry.m_description);
+        ofs << std::endl;
+    }
+}
+
+std::string cLevel_Catalog::Escape(const std::string& str)
+{
+    if (str.empty()) {
+        return "-";
+    }
+    else if (str == "-") {
+        return "%2D";
+    }
+
+    static const char hex_digits[] = "0123456789ABCDEF";
+    std::string result;
+    result.reserve(str.size());
+
+    for (std::string::const_iterator itr = str.begin(); itr != str.end(); ++itr) {
+        const char c = *itr;
+        const unsigned char uc = static_cast<unsigned char>(c);
+
+        // separators, line ends and comments of the file parser
+        if (uc <= ' ' || c == '%' || c == '#') {
+            result += '%';
+            result += hex_digits[uc >> 4];
+            result += hex_digits[uc & 0xF];
+        }
+        else {
+            result += c;
+        }
+    }
+
+    return result;
+}
+
+std::string cLevel_Catalog::Unescape(const std::string& str)
+{
+    if (str == "-") {
+        return "";
+    }
+
+    std::string result;
+    result.reserve(str.size());
+
+    for (size_t i = 0; i < str.size(); i++) {
+        if (str[i] == '%' && i + 2 < str.size() && isxdigit(static_cast<unsigned char>(str[i + 1])) && isxdigit(static_cast<unsigned char>(str[i + 2]))) {
+            result += static_cast<char>(std::stoi(str.substr(i + 1, 2), NULL, 16));
+            i += 2;
+        }
+        else {
+            result += str[i];
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ * level_catalog.hpp  -  Cached information about all level files
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_CATALOG_HPP
+#define TSC_LEVEL_CATALOG_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+#include "../core/file_parser.hpp"
+
+namespace TSC {
+
+    // A level file as listed in the start menu
+    struct cLevel_Catalog_Entry {
+        // level name for cLevel_Manager::Load()
+        std::string m_name;
+        boost::filesystem::path m_path;
+        // modification time of the file when it was read
+        std::time_t m_write_time;
+        // from the user level directory
+        bool m_user;
+
+        std::string m_author;
+        std::string m_description;
+        // 0 = undefined, 1 = dead easy and 100 = ultimate challenge
+        int m_difficulty;
+        LevelLandType m_land_type;
+        std::string m_music;
+        // number of level objects
+        unsigned int m_object_count;
+    };
+
+    /* The level files of the game and user level directories
+     *
+     * The level information is parsed from the start of the level file up
+     * to the settings and the objects are counted by their tags. The
+     * catalog is saved into the user cache directory. On every Update()
+     * only the files which are new or modified since then are read again.
+     * The file has one line per level :
+     * level game|user <file> <time> <difficulty> <land type> <objects> <author> <music> <description>
+     * The file name is relative to the level directory. Spaces and other
+     * special characters in the texts are written as %XX and an empty text
+     * is written as -.
+    */
+    class cLevel_Catalog : public cFile_parser {
+    public:
+        cLevel_Catalog(void);
+        virtual ~cLevel_Catalog(void);
+
+        /* Bring the catalog up to date with the level directories
+         * loads the saved catalog on the first call and saves it if anything changed
+        */
+        void Update(void);
+
+        // Handle one tokenized line
+        virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
+
+        typedef std::vector<cLevel_Catalog_Entry> EntryList;
+        // game levels and then user levels sorted by name
+        EntryList m_entries;
+
+    private:
+        typedef std::map<boost::filesystem::path, cLevel_Catalog_Entry> EntryMap;
+
+        /* Add the level files of the directory
+         * known entries which are not modified are taken from old_entries
+         * returns the number of files which were read
+        */
+        unsigned int Update_Directory(const boost::filesystem::path& dir, bool user, EntryMap& old_entries);
+        /* Read the information from the level file
+         * returns false if it could not be parsed
+        */
+        bool Read_Level_Info(cLevel_Catalog_Entry& entry) const;
+        // Return the number of level object start tags without parsing the XML
+        static unsigned int Count_Level_Objects(const std::string& data);
+
+        /* Load the saved catalog
+         * returns false if it does not exist or has another format
+        */
+        bool Load_From_File(const boost::filesystem::path& filename);
+        // Save for the next start
+        void Save_To_File(const boost::filesystem::path& filename) const;
+
+        // Return the text with special characters replaced for the saved file
+        static std::string Escape(const std::string& str);
+        // Return the text from the saved file
+        static std::string Unescape(const std::string& str);
+
+        // format version of the saved file
+        static const int m_file_version;
+        // bytes given to the information parser at once
+        static const size_t m_header_chunk_size;
+
+        // set if the saved catalog was loaded
+        bool m_loaded;
+        // format version of the loaded file
+        int m_file_loaded_version;
+        // set if a line could not be parsed
+        bool m_parse_error;
+    };
+
+}
+
+#endif // header guard
@@ -65,6 +65,8 @@ cLevelLoader::cLevelLoader()
 {
     mp_level    = NULL;
     m_in_script_tag = false;
+    mp_snapshot = NULL;
+    m_record_only = false;
 }
 
 cLevelLoader::~cLevelLoader()
@@ -79,6 +81,55 @@ cLevel* cLevelLoader::Get_Level()
     return mp_level;
 }
 
+void cLevelLoader::Record_Snapshot(cLevel_Snapshot* p_snapshot)
+{
+    mp_snapshot = p_snapshot;
+}
+
+void cLevelLoader::Record_File(boost::filesystem::path filename, cLevel_Snapshot& snapshot)
+{
+    cLevelLoader loader;
+    loader.Record_Snapshot(&snapshot);
+    loader.m_record_only = true;
+
+    loader.parse_file(filename);
+    snapshot.m_filename = filename;
+}
+
+cLevel* cLevelLoader::Load_From_Snapshot(const cLevel_Snapshot& snapshot)
+{
+    cLevelLoader loader;
+    loader.Start_Snapshot_Loading(snapshot);
+
+    for (cLevel_Snapshot::ElementList::const_iterator iter = snapshot.m_elements.begin(); iter != snapshot.m_elements.end(); iter++) {
+        loader.Load_Snapshot_Element(*iter);
+    }
+
+    return loader.Finish_Snapshot_Loading(snapshot);
+}
+
+void cLevelLoader::Start_Snapshot_Loading(const cLevel_Snapshot& snapshot)
+{
+    m_levelfile = snapshot.m_filename;
+    on_start_document();
+}
+
+void cLevelLoader::Load_Snapshot_Element(const cLevel_Snapshot::cElement& element)
+{
+    // the sprite creation may change the properties
+    m_current_properties = element.m_properties;
+    Handle_Element(element.m_name);
+    m_current_properties.clear();
+}
+
+cLevel* cLevelLoader::Finish_Snapshot_Loading(const cLevel_Snapshot& snapshot)
+{
+    mp_level->m_script = snapshot.m_script;
+    on_end_document();
+
+    return mp_level;
+}
+
 /***************************************
  * SAX parser callbacks
  ***************************************/
@@ -91,6 +142,12 @@ void cLevelLoader::parse_file(boost::filesystem::path filename)
 
 void cLevelLoader::on_start_document()
 {
+    // the level is created from the snapshot later
+    if (m_record_only) {
+        m_in_script_tag = false;
+        return;
+    }
+
     if (mp_level)
         throw("Restarted XML parser after already starting it."); // FIXME: proper exception
 
@@ -100,11 +157,17 @@ void cLevelLoader::on_start_document()
 
 void cLevelLoader::on_end_document()
 {
+    if (m_record_only)
+        return;
+
     mp_level->m_level_filename = m_levelfile;
 
     // engine version entry not set
     if (mp_level->m_engine_version < 0)
         mp_level->m_engine_version = 0;
+
+    if (mp_snapshot)
+        mp_snapshot->m_script = mp_level->m_script;
 }
 
 void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
@@ -143,6 +206,23 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
     if (name == "property" || name == "Property")
         return;
 
+    // Copy the properties before the sprite creation can change them
+    if (mp_snapshot)
+        mp_snapshot->Add_Element(name, m_current_properties);
+
+    if (!m_record_only)
+        Handle_Element(name);
+    else if (name == "script")
+        m_in_script_tag = false;
+
+    // Everything handled, so we can now safely clear the
+    // collected <property> element values for the next
+    // tag.
+    m_current_properties.clear();
+}
+
+void cLevelLoader::Handle_Element(const std::string& name)
+{
     // Now for the real, cumbersome parsing process
     if (name == "information")
         Parse_Tag_Information();
@@ -152,7 +232,7 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
         Parse_Tag_Background();
     else if (name == "player")
         Parse_Tag_Player();
-    else if (cLevel::Is_Level_Object_Element(std::string(name))) // CEGUI doesn’t like Glib::ustring
+    else if (cLevel::Is_Level_Object_Element(name))
         Parse_Level_Object_Tag(name);
     else if (name == "level") {
         /* Ignore the root <level> tag */
@@ -161,11 +241,6 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
         m_in_script_tag = false; // Indicate the <script> tag has ended
     else
         cerr << "Warning: Unknown XML tag '" << name << "'on level parsing." << endl;
-
-    // Everything handled, so we can now safely clear the
-    // collected <property> element values for the next
-    // tag.
-    m_current_properties.clear();
 }
 
 void cLevelLoader::on_characters(const Glib::ustring& text)
@@ -173,7 +248,12 @@ void cLevelLoader::on_characters(const Glib::ustring& text)
     /* If we’re currently in the <script> tag, read its
      * text (may be called multiple times for each token,
      * so append rather then set directly). */
-    if (m_in_script_tag)
+    if (!m_in_script_tag)
+        return;
+
+    if (m_record_only)
+        mp_snapshot->m_script.append(text);
+    else
         mp_level->m_script.append(text);
 }
 
@@ -18,6 +18,7 @@
 #include "../core/global_game.hpp"
 #include "../core/xml_attributes.hpp"
 #include "level.hpp"
+#include "level_snapshot.hpp"
 
 namespace TSC {
 
@@ -59,6 +60,25 @@ namespace TSC {
         // After finishing parsing, contains a pointer to a cLevel instance.
         // This pointer must be freed by you. Returns NULL before parsing.
         cLevel* Get_Level();
+        // Record the parsed elements into the given snapshot. Call before
+        // parsing. The snapshot is not freed by the loader.
+        void Record_Snapshot(cLevel_Snapshot* p_snapshot);
+
+        // Parse the given file into the snapshot without creating the
+        // level. Load_From_Snapshot() creates the level from it then.
+        static void Record_File(boost::filesystem::path filename, cLevel_Snapshot& snapshot);
+
+        // Create the level from the elements recorded in the snapshot
+        // instead of parsing the file again. The returned cLevel must
+        // be freed by you.
+        static cLevel* Load_From_Snapshot(const cLevel_Snapshot& snapshot);
+        // The steps of Load_From_Snapshot() for creating the level
+        // over several frames. Start_Snapshot_Loading() creates the
+        // level, Load_Snapshot_Element() is called for every element
+        // in order and Finish_Snapshot_Loading() returns the level.
+        void Start_Snapshot_Loading(const cLevel_Snapshot& snapshot);
+        void Load_Snapshot_Element(const cLevel_Snapshot::cElement& element);
+        cLevel* Finish_Snapshot_Loading(const cLevel_Snapshot& snapshot);
 
     protected: // SAX parser callbacks
         virtual void on_start_document();
@@ -86,6 +106,9 @@ namespace TSC {
         static std::vector<cSprite*> Create_Lavas_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
         static std::vector<cSprite*> Create_Crates_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
 
+        // Handle a closed element with the collected <property> values
+        void Handle_Element(const std::string& name);
+
         void Parse_Tag_Information();
         void Parse_Tag_Settings();
         void Parse_Tag_Background();
@@ -102,6 +125,10 @@ namespace TSC {
         XmlAttributes m_current_properties;
         // True if we’re currently parsing a <script> tag.
         bool m_in_script_tag;
+        // Snapshot to record the elements into or NULL.
+        cLevel_Snapshot* mp_snapshot;
+        // True if the elements are only recorded and no level is created.
+        bool m_record_only;
     };
 
 }
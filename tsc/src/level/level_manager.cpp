@@ -25,8 +25,10 @@
 #include "../objects/path.hpp"
 #include "../audio/audio.hpp"
 #include "level_settings.hpp"
+#include "level_loader.hpp"
 #include "../level/level_editor.hpp"
 #include "../core/filesystem/resource_manager.hpp"
+#include "../video/video.hpp"
 #include "../input/mouse.hpp"
 #include "../core/global_basic.hpp"
 #include "../gui/hud.hpp"
@@ -40,6 +42,8 @@ namespace TSC {
 
 /* *** *** *** *** *** cLevel_Manager *** *** *** *** *** *** *** *** *** *** *** *** */
 
+const unsigned int cLevel_Manager::m_snapshot_limit = 4;
+
 cLevel_Manager::cLevel_Manager(void)
     : cObject_Manager<cLevel>()
 {
@@ -59,6 +63,12 @@ cLevel_Manager::cLevel_Manager(void)
 
 cLevel_Manager::~cLevel_Manager(void)
 {
+    Cancel_Prefetch();
+
+    for (LevelSnapshotList::iterator itr = m_snapshots.begin(); itr != m_snapshots.end(); ++itr) {
+        delete *itr;
+    }
+
     Delete_All();
     delete m_camera;
 }
@@ -132,12 +142,134 @@ cLevel* cLevel_Manager::Load(std::string levelname , bool loading_sublevel /* =
 
     // load
     fs::path filename = Get_Path(levelname);
-    level = cLevel::Load_From_File(filename);
+    cLevel_Snapshot* prefetch_snapshot = NULL;
+    level = m_prefetch.Take_Level(levelname, filename, prefetch_snapshot);
+
+    if (level) {
+        Add_Snapshot(prefetch_snapshot);
+    }
+    else {
+        cLevel_Snapshot* snapshot = Get_Snapshot(filename);
+
+        // from memory
+        if (snapshot) {
+            {
+                // images may have been unloaded since
+                cImage_Preload preload(snapshot->Get_Image_Files());
+                level = cLevelLoader::Load_From_Snapshot(*snapshot);
+            }
+
+            level->Init_Links();
+
+            debug_print("Loaded level from snapshot: %s\n", path_to_utf8(level->m_level_filename).c_str());
+        }
+        else {
+            snapshot = new cLevel_Snapshot();
+
+            try {
+                level = cLevel::Load_From_File(filename, snapshot);
+            }
+            catch (...) {
+                delete snapshot;
+                throw;
+            }
+
+            if (level) {
+                snapshot->Set_File(filename);
+                Add_Snapshot(snapshot);
+            }
+            else {
+                delete snapshot;
+            }
+        }
+    }
 
     Add(level);
     return level;
 }
 
+void cLevel_Manager::Prefetch(const std::string& levelname)
+{
+    // already loaded
+    if (Get(levelname)) {
+        Cancel_Prefetch();
+        return;
+    }
+
+    if (!m_prefetch.Is_Loading(levelname)) {
+        fs::path filename = Get_Path(levelname);
+
+        // only the supported level format
+        if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) {
+            return;
+        }
+
+        m_prefetch.Start(levelname, filename);
+    }
+
+    m_prefetch.Update();
+}
+
+void cLevel_Manager::Cancel_Prefetch(void)
+{
+    m_prefetch.Cancel();
+}
+
+void cLevel_Manager::Delete_Snapshot(const fs::path& filename)
+{
+    for (LevelSnapshotList::iterator itr = m_snapshots.begin(); itr != m_snapshots.end(); ++itr) {
+        cLevel_Snapshot* snapshot = (*itr);
+
+        boost::system::error_code ec;
+
+        if (snapshot->m_filename == filename || fs::equivalent(snapshot->m_filename, filename, ec)) {
+            m_snapshots.erase(itr);
+            delete snapshot;
+            return;
+        }
+    }
+}
+
+cLevel_Snapshot* cLevel_Manager::Get_Snapshot(const fs::path& filename)
+{
+    for (LevelSnapshotList::iterator itr = m_snapshots.begin(); itr != m_snapshots.end(); ++itr) {
+        cLevel_Snapshot* snapshot = (*itr);
+
+        if (snapshot->m_filename != filename) {
+            continue;
+        }
+
+        // file changed
+        if (!snapshot->Is_Valid()) {
+            m_snapshots.erase(itr);
+            delete snapshot;
+            return NULL;
+        }
+
+        // last used
+        m_snapshots.erase(itr);
+        m_snapshots.push_back(snapshot);
+
+        return snapshot;
+    }
+
+    return NULL;
+}
+
+void cLevel_Manager::Add_Snapshot(cLevel_Snapshot* snapshot)
+{
+    // an older one of the same file
+    Delete_Snapshot(snapshot->m_filename);
+
+    m_snapshots.push_back(snapshot);
+
+    // forget the least recently used
+    if (m_snapshots.size() > m_snapshot_limit) {
+        delete m_snapshots.front();
+        m_snapshots.erase(m_snapshots.begin());
+    }
+}
+
 bool cLevel_Manager::Set_Active(cLevel* level)
 {
     if (!level) {
@@ -229,6 +361,13 @@ fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_
 
 void cLevel_Manager::Update(void)
 {
+    // drawing interpolates from the positions before this step
+    if (pFramerate->m_fixed_timestep) {
+        pActive_Level->m_sprite_manager->Store_Interpolation_Pos();
+        pLevel_Player->Store_Interpolation_Pos();
+        pActive_Camera->Store_Interpolation_Pos();
+    }
+
     // input
     pActive_Level->Process_Input();
 
@@ -281,6 +420,11 @@ void cLevel_Manager::Update(void)
 
     // update performance timer
     pFramerate->m_perf_timer[PERF_UPDATE_CAMERA]->Update();
+
+    // script time of this frame
+    if (pActive_Level->m_mruby) {
+        pActive_Level->m_mruby->Get_Profiler().End_Frame();
+    }
 }
 
 void cLevel_Manager::Draw(void)
@@ -288,6 +432,15 @@ void cLevel_Manager::Draw(void)
     // clear
     pVideo->Clear_Screen();
 
+    // draw between the last two fixed steps
+    const bool interpolate = pFramerate->m_fixed_timestep && !editor_enabled;
+
+    if (interpolate) {
+        pActive_Camera->Apply_Interpolation_Pos(pFramerate->m_interpolation);
+        pLevel_Player->Apply_Interpolation_Pos(pFramerate->m_interpolation);
+        pActive_Level->m_sprite_manager->Apply_Interpolation_Pos(pFramerate->m_interpolation);
+    }
+
     // draw level layer 1
     pActive_Level->Draw_Layer_1();
 
@@ -311,6 +464,12 @@ void cLevel_Manager::Draw(void)
 
     // update performance timer
     pFramerate->m_perf_timer[PERF_DRAW_LEVEL_EDITOR]->Update();
+
+    if (interpolate) {
+        pActive_Level->m_sprite_manager->Restore_Interpolation_Pos();
+        pLevel_Player->Restore_Interpolation_Pos();
+        pActive_Camera->Restore_Interpolation_Pos();
+    }
 }
 
 void cLevel_Manager::Finish_Level(bool win_music /* = 0 */, std::string taken_exit /* = "" */)
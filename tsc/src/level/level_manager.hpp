@@ -21,6 +21,9 @@
 #include "../core/obj_manager.hpp"
 #include "../core/camera.hpp"
 #include "../level/level.hpp"
+#include "../level/level_catalog.hpp"
+#include "../level/level_prefetch.hpp"
+#include "../level/level_snapshot.hpp"
 
 namespace TSC {
 
@@ -46,9 +49,19 @@ namespace TSC {
         cLevel* New(std::string levelname);
         /* Load level and returns it if successful
          * If the level is already loaded it is returned but not reloaded.
+         * A prefetched level is taken over instead of loading it again.
+         * A level loaded before is created from its snapshot if the file is unchanged.
          * The loaded level is not set active.
         */
         cLevel* Load(std::string levelname, bool loading_sublevel = false);
+        /* Continue loading the given level in the background
+         * call every frame while the level is likely to be entered next
+        */
+        void Prefetch(const std::string& levelname);
+        // Throw the prefetched level away
+        void Cancel_Prefetch(void);
+        // Delete the snapshot of the given level file after it was changed
+        void Delete_Snapshot(const boost::filesystem::path& filename);
         // Set active level
         bool Set_Active(cLevel* level);
         // Get level pointer
@@ -80,6 +93,23 @@ namespace TSC {
 
         // level camera
         cCamera* m_camera;
+        // level files listed in the start menu
+        cLevel_Catalog m_catalog;
+
+        // number of level snapshots kept in memory
+        static const unsigned int m_snapshot_limit;
+
+    private:
+        // Return the valid snapshot of the given level file or NULL
+        cLevel_Snapshot* Get_Snapshot(const boost::filesystem::path& filename);
+        // Keep the snapshot of a loaded level file and forget the least recently used
+        void Add_Snapshot(cLevel_Snapshot* snapshot);
+
+        cLevel_Prefetch m_prefetch;
+
+        // snapshots of the loaded level files with the last used at the end
+        typedef vector<cLevel_Snapshot*> LevelSnapshotList;
+        LevelSnapshotList m_snapshots;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -21,6 +21,7 @@
 #include "../core/filesystem/resource_manager.hpp"
 #include "../user/preferences.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_recorder.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../core/framerate.hpp"
 #include "../audio/audio.hpp"
@@ -181,7 +182,7 @@ bool cLevel_Player::Set_On_Ground(cSprite* obj, bool set_on_top /* = 1 */)
         }
 
         // if massive ground and ducking key is pressed
-        if (m_ground_object->m_massive_type == MASS_MASSIVE && (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down())) {
+        if (m_ground_object->m_massive_type == MASS_MASSIVE && (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down())) {
             Start_Ducking();
         }
     }
@@ -284,7 +285,9 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
     float i;
 
     for (i = 0.0f; i < 7.0f; i += pFramerate->m_speed_factor) {
-        while (pVideo->PollEvent(input_event)) {
+        pInput_Recorder->Next_Tick();
+
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
                 if (input_event.key.code == sf::Keyboard::Escape) {
                     goto animation_end;
@@ -316,7 +319,9 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
     m_walk_count = 0.0f;
 
     for (i = 0.0f; m_col_rect.m_y < pActive_Camera->m_y + game_res_h; i++) {
-        while (pVideo->PollEvent(input_event)) {
+        pInput_Recorder->Next_Tick();
+
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
                 if (input_event.key.code == sf::Keyboard::Escape) {
                     goto animation_end;
@@ -383,7 +388,9 @@ animation_end:
         anim->Set_Const_Rotation_Z(-2.0f, 4.0f);
 
         for (i = 10.0f; i > 0.0f; i -= 0.011f * pFramerate->m_speed_factor) {
-            while (pVideo->PollEvent(input_event)) {
+            pInput_Recorder->Next_Tick();
+
+            while (pInput_Recorder->Poll_Event(input_event)) {
                 if (input_event.type == sf::Event::KeyPressed) {
                     if (input_event.key.code == pPreferences->m_key_screenshot) {
                         pVideo->Save_Screenshot();
@@ -394,12 +401,12 @@ animation_end:
             // TODO: Why is the below not simply handled as events in the above event loop?
 
             // Escape stops
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape) || sf::Keyboard::isKeyPressed(sf::Keyboard::Return) ||sf::Keyboard::isKeyPressed(sf::Keyboard::Space) || sf::Keyboard::isKeyPressed(pPreferences->m_key_action)) {
+            if (pKeyboard->Is_Key_Down(sf::Keyboard::Escape) || pKeyboard->Is_Key_Down(sf::Keyboard::Return) ||pKeyboard->Is_Key_Down(sf::Keyboard::Space) || pKeyboard->Is_Key_Down(pPreferences->m_key_action)) {
                 break;
             }
 
             // if joystick enabled and exit pressed
-            if (pPreferences->m_joy_enabled && sf::Joystick::isButtonPressed(pJoystick->m_current_joystick, pPreferences->m_joy_button_exit)) {
+            if (pJoystick->Button(pPreferences->m_joy_button_exit)) {
                 break;
             }
 
@@ -631,7 +638,7 @@ void cLevel_Player::Update_Walking(void)
     }
 
     // only if left or right is pressed, and game console is not open
-    if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Left() || pJoystick->Right()) && !gp_game_console->IsVisible()) {
+    if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Left() || pJoystick->Right()) && !gp_game_console->IsVisible()) {
         float ground_mod = 1.0f;
 
         if (m_ground_object && m_ground_object->m_image) {
@@ -735,7 +742,7 @@ void cLevel_Player::Update_Staying(void)
     }
 
     // if left and right is not pressed
-    if (!sf::Keyboard::isKeyPressed(pPreferences->m_key_left) && !sf::Keyboard::isKeyPressed(pPreferences->m_key_right) && !pJoystick->Left() && !pJoystick->Right()) {
+    if (!pKeyboard->Is_Key_Down(pPreferences->m_key_left) && !pKeyboard->Is_Key_Down(pPreferences->m_key_right) && !pJoystick->Left() && !pJoystick->Right()) {
         // walking
         if (m_velx) {
             if (m_ground_object->m_image && m_ground_object->m_image->m_ground_type == GROUND_ICE) {
@@ -801,7 +808,7 @@ void cLevel_Player::Update_Flying(void)
         }
 
         // move down
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             const float max_vel = 5.0f * Get_Vel_Modifier();
 
             if (m_vely < max_vel) {
@@ -809,7 +816,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move up
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             const float max_vel = -5.0f * Get_Vel_Modifier();
 
             if (m_vely > max_vel) {
@@ -828,7 +835,7 @@ void cLevel_Player::Update_Flying(void)
     // falling
     else {
         // move left
-        if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
+        if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = -10.0f * Get_Vel_Modifier();
 
@@ -846,7 +853,7 @@ void cLevel_Player::Update_Flying(void)
             }
         }
         // move right
-        else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
+        else if ((pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
             if (!m_parachute) {
                 const float max_vel = 10.0f * Get_Vel_Modifier();
 
@@ -1086,17 +1093,17 @@ void cLevel_Player::Update_Climbing(void)
 
     if (Is_On_Climbable()) {
         // set velocity
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             m_velx = -2.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             m_velx = 2.0f * Get_Vel_Modifier();
         }
 
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             m_vely = -4.0f * Get_Vel_Modifier();
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             m_vely = 4.0f * Get_Vel_Modifier();
         }
 
@@ -1189,7 +1196,7 @@ void cLevel_Player::Start_Jump(float deaccel /* = 0.08f */)
     bool jump_key = 0;
 
     // if jump key pressed
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
         jump_key = 1;
     }
 
@@ -1272,7 +1279,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // jumping physics
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_jump) || pJoystick->Button(pPreferences->m_joy_button_jump)) {
         Add_Velocity_Y(-(m_jump_accel_up + (m_vely * m_jump_vel_deaccel) / Get_Vel_Modifier()));
         m_jump_power -= pFramerate->m_speed_factor;
     }
@@ -1282,7 +1289,7 @@ void cLevel_Player::Update_Jump(void)
     }
 
     // left right physics
-    if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
+    if ((pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) && !m_ducked_counter) {
         const float max_vel = -10.0f * Get_Vel_Modifier();
 
         if (m_velx > max_vel) {
@@ -1290,7 +1297,7 @@ void cLevel_Player::Update_Jump(void)
         }
 
     }
-    else if ((sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
+    else if ((pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) && !m_ducked_counter) {
         const float max_vel = 10.0f * Get_Vel_Modifier();
 
         if (m_velx < max_vel) {
@@ -1355,7 +1362,7 @@ void cLevel_Player::Update_Item(void)
     }
 
     // if control is pressed search for items in front of the player
-    if (sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pKeyboard->Is_Key_Down(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
         // next position velocity with extra size
         float check_x = (m_velx > 0.0f) ? (m_velx + 5.0f) : (m_velx - 5.0f);
 
@@ -2871,7 +2878,7 @@ float cLevel_Player::Get_Vel_Modifier(void) const
     float vel_mod = 1.0f;
 
     // if running key is pressed or always run
-    if (pPreferences->m_always_run || sf::Keyboard::isKeyPressed(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
+    if (pPreferences->m_always_run || pKeyboard->Is_Key_Down(pPreferences->m_key_action) || pJoystick->Button(pPreferences->m_joy_button_action)) {
         vel_mod = 1.5f;
     }
 
@@ -2917,8 +2924,10 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
 {
     // Up
     if (key_type == INP_UP) {
-        // Search for colliding climbable or level exit
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        // Search for colliding level exit
+        const cSprite_List& level_exits = m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT);
+
+        for (cSprite_List::const_iterator itr = level_exits.begin(); itr != level_exits.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // skip destroyed objects
@@ -2930,37 +2939,46 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
                 continue;
             }
 
-            // level exit
-            if (obj->m_type == TYPE_LEVEL_EXIT) {
-                cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
+            cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
 
-                // beam
-                if (level_exit->m_exit_type == LEVEL_EXIT_BEAM) {
-                    // needs to be on ground
-                    if (m_ground_object) {
+            // beam
+            if (level_exit->m_exit_type == LEVEL_EXIT_BEAM) {
+                // needs to be on ground
+                if (m_ground_object) {
+                    Game_Action = GA_ACTIVATE_LEVEL_EXIT;
+                    Game_Action_ptr = level_exit;
+                }
+            }
+            // warp
+            else if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
+                if (level_exit->m_direction == DIR_UP) {
+                    if (m_vely <= 0) {
                         Game_Action = GA_ACTIVATE_LEVEL_EXIT;
                         Game_Action_ptr = level_exit;
                     }
                 }
-                // warp
-                else if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
-                    if (level_exit->m_direction == DIR_UP) {
-                        if (m_vely <= 0) {
-                            Game_Action = GA_ACTIVATE_LEVEL_EXIT;
-                            Game_Action_ptr = level_exit;
-                        }
-                    }
-                }
+            }
 
-                // if leaving level
-                if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
-                    Game_Action_Data_Start.add("music_fadeout", "1000");
-                }
+            // if leaving level
+            if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
+                Game_Action_Data_Start.add("music_fadeout", "1000");
+            }
+
+            return;
+        }
 
-                return;
+        // Search for colliding climbable if no level exit is touched
+        const cSprite_List& actives = m_sprite_manager->Get_Objects_by_Array(ARRAY_ACTIVE);
+
+        for (cSprite_List::const_iterator itr = actives.begin(); itr != actives.end(); ++itr) {
+            cSprite* obj = (*itr);
+
+            // skip destroyed objects
+            if (obj->m_auto_destroy) {
+                continue;
             }
-            // climbable
-            else if (obj->m_massive_type == MASS_CLIMBABLE) {
+
+            if (obj->m_massive_type == MASS_CLIMBABLE && m_col_rect.Intersects(obj->m_col_rect)) {
                 Start_Climbing();
             }
         }
@@ -2968,7 +2986,9 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     // Down
     else if (key_type == INP_DOWN) {
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        const cSprite_List& level_exits = m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT);
+
+        for (cSprite_List::const_iterator itr = level_exits.begin(); itr != level_exits.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // skip destroyed objects
@@ -3018,7 +3038,9 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     // Left
     else if (key_type == INP_LEFT) {
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        const cSprite_List& level_exits = m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT);
+
+        for (cSprite_List::const_iterator itr = level_exits.begin(); itr != level_exits.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // skip destroyed objects
@@ -3066,7 +3088,9 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     // Right
     else if (key_type == INP_RIGHT) {
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        const cSprite_List& level_exits = m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT);
+
+        for (cSprite_List::const_iterator itr = level_exits.begin(); itr != level_exits.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // skip destroyed objects
@@ -3185,7 +3209,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Left
     else if (key_type == INP_LEFT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             m_direction = DIR_RIGHT;
         }
         else {
@@ -3195,7 +3219,7 @@ void cLevel_Player::Action_Stop_Interact(input_identifier key_type)
     // Right
     else if (key_type == INP_RIGHT) {
         // if key in opposite direction is still pressed only change direction
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             m_direction = DIR_LEFT;
         }
         else {
@@ -3263,10 +3287,9 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
 
         for (unsigned int i = 0; i < amount; i++) {
             // add ball
-            cBall* ball = new cBall(m_sprite_manager);
+            cBall* ball = cBall::Create(m_sprite_manager, effect_type);
             ball->Set_Pos(ball_posx, m_rect.m_y + (m_rect.m_h * 0.7f) - 20, 1);
             ball->Set_Origin(m_sprite_array, m_type);
-            ball->Set_Ball_Type(effect_type);
             m_sprite_manager->Add(ball);
 
             // set speed
@@ -3300,10 +3323,9 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             ball_angle += 180.0f / amount;
 
             // add ball
-            cBall* ball = new cBall(m_sprite_manager);
+            cBall* ball = cBall::Create(m_sprite_manager, effect_type);
             ball->Set_Pos(m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2, 1);
             ball->Set_Origin(m_sprite_array, m_type);
-            ball->Set_Ball_Type(effect_type);
             ball->Set_Velocity_From_Angle(ball_angle, 15);
             if (ball->m_velx > 0.0f) {
                 ball->m_direction = DIR_RIGHT;
@@ -3318,7 +3340,7 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
 
         // explosion animation and sound
         if (effect_type == FIREBALL_EXPLOSION) {
-            cAnimation_Fireball* anim = new cAnimation_Fireball(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 2), m_pos_y + (m_col_rect.m_h / 3), 10);
+            cAnimation_Fireball* anim = cAnimation_Fireball::Create(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 2), m_pos_y + (m_col_rect.m_h / 3), 10);
             anim->Set_Fading_Speed(0.3f);
             pActive_Animation_Manager->Add(anim);
 
@@ -3353,16 +3375,14 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
 void cLevel_Player::Ball_Clear(void) const
 {
     // destroy all fireballs from the player
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    const cSprite_List& balls = m_sprite_manager->Get_Objects_by_Type(TYPE_BALL);
 
-        if (obj->m_type == TYPE_BALL) {
-            cBall* ball = static_cast<cBall*>(obj);
+    for (cSprite_List::const_iterator itr = balls.begin(); itr != balls.end(); ++itr) {
+        cBall* ball = static_cast<cBall*>(*itr);
 
-            // if from player
-            if (ball->m_origin_type == TYPE_PLAYER) {
-                obj->Destroy();
-            }
+        // if from player
+        if (ball->m_origin_type == TYPE_PLAYER) {
+            ball->Destroy();
         }
     }
 }
@@ -3523,7 +3543,7 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
     }
     else if (obj->m_massive_type == MASS_HALFMASSIVE) {
         // fall through
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             return COL_VTYPE_NOT_VALID;
         }
 
@@ -3571,22 +3591,22 @@ Col_Valid_Type cLevel_Player::Validate_Collision(cSprite* obj)
             // warp levelexit key check
             if (levelexit->m_exit_type == LEVEL_EXIT_WARP) {
                 // joystick events are sent as keyboard keys
-                if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+                if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
                     if (levelexit->m_start_direction == DIR_UP) {
                         Action_Interact(INP_UP);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
                     if (levelexit->m_start_direction == DIR_DOWN) {
                         Action_Interact(INP_DOWN);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
                     if (levelexit->m_start_direction == DIR_RIGHT) {
                         Action_Interact(INP_RIGHT);
                     }
                 }
-                else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+                else if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
                     if (levelexit->m_start_direction == DIR_LEFT) {
                         Action_Interact(INP_LEFT);
                     }
@@ -3754,7 +3774,7 @@ void cLevel_Player::Handle_Collision_Massive(cObjectCollision* collision)
     // climbable
     if (col_obj->m_massive_type == MASS_CLIMBABLE && m_state != STA_CLIMB && m_state != STA_FLY) {
         // if not climbing and player wants to climb
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up() || ((sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) && !m_ground_object)) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up() || ((pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) && !m_ground_object)) {
             // start climbing
             Start_Climbing();
         }
@@ -0,0 +1,306 @@
+/***************************************************************************
+ * level_prefetch.cpp  -  Loading a level before it is entered
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../core/game_core.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../level/level.hpp"
+#include "../level/level_loader.hpp"
+#include "../level/level_prefetch.hpp"
+#include "../level/level_snapshot.hpp"
+#include "../video/video.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cLevel_Prefetch *** *** *** *** *** *** *** *** *** *** *** */
+
+const uint64_t cLevel_Prefetch::m_frame_time_limit = 2000;
+
+cLevel_Prefetch::cLevel_Prefetch(void)
+{
+    m_images_added = 0;
+    mp_loader = NULL;
+    m_element_pos = 0;
+    m_failed = 0;
+}
+
+cLevel_Prefetch::~cLevel_Prefetch(void)
+{
+    // do not leave the threads running on exit
+    if (m_record_thread.joinable()) {
+        m_record_thread.join();
+    }
+    if (m_decode_thread.joinable()) {
+        m_decode_thread.join();
+    }
+
+    Cancel();
+}
+
+void cLevel_Prefetch::Start(const std::string& levelname, const fs::path& filename)
+{
+    if (m_levelname == levelname && m_filename == filename) {
+        return;
+    }
+
+    Cancel();
+
+    m_levelname = levelname;
+    m_filename = filename;
+
+    m_record_job = std::make_shared<cRecord_Job>();
+    m_record_job->m_filename = m_filename;
+    m_record_thread = boost::thread(&cLevel_Prefetch::Record, m_record_job);
+
+    debug_print("Prefetching level: %s\n", path_to_utf8(m_filename).c_str());
+}
+
+void cLevel_Prefetch::Update(void)
+{
+    if (m_levelname.empty() || m_failed || !m_record_job->m_done) {
+        return;
+    }
+
+    if (!m_record_job->m_ok) {
+        m_failed = 1;
+        return;
+    }
+
+    // finding the image files takes the time of this frame
+    if (!m_decode_job) {
+        Start_Decoding();
+        return;
+    }
+
+    if (!m_images_added) {
+        if (!m_decode_job->m_done) {
+            return;
+        }
+
+        Add_Images();
+    }
+
+    const cLevel_Snapshot* snapshot = m_record_job->mp_snapshot;
+    const uint64_t start = TSC_GetMicroTicks();
+
+    // checked for every element as one can create many sprites
+    while (m_element_pos < snapshot->m_elements.size() && TSC_GetMicroTicks() - start < m_frame_time_limit) {
+        if (!Load_Element()) {
+            m_failed = 1;
+            Delete_Level();
+            return;
+        }
+    }
+}
+
+void cLevel_Prefetch::Cancel(void)
+{
+    // the jobs are deleted by the threads if they still run
+    if (m_record_thread.joinable()) {
+        m_record_thread.detach();
+    }
+    if (m_decode_thread.joinable()) {
+        m_decode_thread.detach();
+    }
+
+    Delete_Level();
+
+    // images which were not taken by the level
+    if (m_images_added) {
+        pVideo->Clear_Preloaded_Images();
+    }
+
+    m_record_job.reset();
+    m_decode_job.reset();
+    m_images_added = 0;
+    m_levelname.clear();
+    m_filename.clear();
+    m_failed = 0;
+}
+
+cLevel* cLevel_Prefetch::Take_Level(const std::string& levelname, const fs::path& filename, cLevel_Snapshot*& p_snapshot)
+{
+    p_snapshot = NULL;
+
+    if (m_levelname != levelname || m_filename != filename || m_failed) {
+        Cancel();
+        return NULL;
+    }
+
+    if (m_record_thread.joinable()) {
+        m_record_thread.join();
+    }
+
+    if (!m_record_job->m_ok) {
+        Cancel();
+        return NULL;
+    }
+
+    // load the rest
+    if (!m_decode_job) {
+        Start_Decoding();
+    }
+
+    if (m_decode_thread.joinable()) {
+        m_decode_thread.join();
+    }
+
+    if (!m_images_added) {
+        Add_Images();
+    }
+
+    while (m_element_pos < m_record_job->mp_snapshot->m_elements.size() || !mp_loader) {
+        if (!Load_Element()) {
+            Cancel();
+            return NULL;
+        }
+    }
+
+    cLevel* level = NULL;
+
+    try {
+        level = mp_loader->Finish_Snapshot_Loading(*m_record_job->mp_snapshot);
+    }
+    catch (const std::exception& e) {
+        debug_print("Prefetching level %s failed : %s\n", m_levelname.c_str(), e.what());
+    }
+
+    if (!level) {
+        Cancel();
+        return NULL;
+    }
+
+    // the caller owns them now
+    delete mp_loader;
+    mp_loader = NULL;
+    p_snapshot = m_record_job->mp_snapshot;
+    m_record_job->mp_snapshot = NULL;
+    Cancel();
+
+    level->Init_Links();
+
+    debug_print("Loaded prefetched level: %s\n", path_to_utf8(level->m_level_filename).c_str());
+
+    return level;
+}
+
+bool cLevel_Prefetch::Is_Loading(const std::string& levelname) const
+{
+    return m_levelname == levelname;
+}
+
+cLevel_Prefetch::cRecord_Job::cRecord_Job(void)
+    : m_done(false)
+{
+    mp_snapshot = new cLevel_Snapshot();
+    m_ok = 0;
+}
+
+cLevel_Prefetch::cRecord_Job::~cRecord_Job(void)
+{
+    delete mp_snapshot;
+}
+
+cLevel_Prefetch::cDecode_Job::cDecode_Job(void)
+    : m_done(false)
+{
+    //
+}
+
+cLevel_Prefetch::cDecode_Job::~cDecode_Job(void)
+{
+    for (std::vector<sf::Image*>::iterator itr = m_images.begin(); itr != m_images.end(); ++itr) {
+        delete *itr;
+    }
+}
+
+void cLevel_Prefetch::Record(std::shared_ptr<cRecord_Job> job)
+{
+    // only parses and does not create sprites
+    try {
+        job->mp_snapshot->Set_File(job->m_filename);
+        cLevelLoader::Record_File(job->m_filename, *job->mp_snapshot);
+        job->m_ok = 1;
+    }
+    catch (const std::exception& e) {
+        debug_print("Prefetching level %s failed : %s\n", path_to_utf8(job->m_filename).c_str(), e.what());
+    }
+
+    job->m_done = true;
+}
+
+void cLevel_Prefetch::Decode(std::shared_ptr<cDecode_Job> job)
+{
+    job->m_images = cVideo::Decode_Images(job->m_files);
+    job->m_done = true;
+}
+
+void cLevel_Prefetch::Start_Decoding(void)
+{
+    m_decode_job = std::make_shared<cDecode_Job>();
+    m_decode_job->m_files = pVideo->Get_Preload_Files(m_record_job->mp_snapshot->Get_Image_Files());
+    m_decode_thread = boost::thread(&cLevel_Prefetch::Decode, m_decode_job);
+}
+
+void cLevel_Prefetch::Add_Images(void)
+{
+    pVideo->Add_Preloaded_Images(m_decode_job->m_files, m_decode_job->m_images);
+    // owned by the video preload now
+    m_decode_job->m_images.clear();
+    m_images_added = 1;
+}
+
+bool cLevel_Prefetch::Load_Element(void)
+{
+    const cLevel_Snapshot* snapshot = m_record_job->mp_snapshot;
+
+    try {
+        if (!mp_loader) {
+            mp_loader = new cLevelLoader();
+            mp_loader->Start_Snapshot_Loading(*snapshot);
+            m_element_pos = 0;
+        }
+
+        if (m_element_pos < snapshot->m_elements.size()) {
+            mp_loader->Load_Snapshot_Element(snapshot->m_elements[m_element_pos]);
+            m_element_pos++;
+        }
+    }
+    catch (const std::exception& e) {
+        debug_print("Prefetching level %s failed : %s\n", m_levelname.c_str(), e.what());
+        return 0;
+    }
+
+    return 1;
+}
+
+void cLevel_Prefetch::Delete_Level(void)
+{
+    if (mp_loader) {
+        delete mp_loader->Get_Level();
+        delete mp_loader;
+        mp_loader = NULL;
+    }
+
+    m_element_pos = 0;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,128 @@
+/***************************************************************************
+ * level_prefetch.hpp  -  Loading a level before it is entered
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_PREFETCH_HPP
+#define TSC_LEVEL_PREFETCH_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    class cLevel;
+    class cLevelLoader;
+    class cLevel_Snapshot;
+
+    /* *** *** *** *** *** *** cLevel_Prefetch *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Loads the level the overworld player stands in front of
+     *
+     * The level is loaded like cLevel::Load_From_File() does it. The file
+     * is parsed into a snapshot and the images are decoded on worker
+     * threads. The sprites load their textures and can only be created on
+     * the main thread, so they are created from the snapshot one element
+     * at a time with a time limit for every frame.
+     * The finished level is handed over by Take_Level() when it is entered.
+    */
+    class cLevel_Prefetch {
+    public:
+        cLevel_Prefetch(void);
+        ~cLevel_Prefetch(void);
+
+        /* Start loading the given level file
+         * does nothing if it is already loading
+        */
+        void Start(const std::string& levelname, const boost::filesystem::path& filename);
+        // Load the next part of the level within the frame time limit
+        void Update(void);
+        /* Stop loading and delete the level
+         * running worker threads are left to finish on their own
+        */
+        void Cancel(void);
+
+        /* Return the level if it is the prefetched one and NULL otherwise
+         * the rest of the level is loaded first
+         * the caller owns the level which is removed from the prefetch
+         * and the snapshot it was loaded from which is set in p_snapshot
+        */
+        cLevel* Take_Level(const std::string& levelname, const boost::filesystem::path& filename, cLevel_Snapshot*& p_snapshot);
+
+        // Return true if the given level is being loaded or failed to load
+        bool Is_Loading(const std::string& levelname) const;
+
+        // time limit for every frame in microseconds
+        static const uint64_t m_frame_time_limit;
+
+    private:
+        /* Work of a worker thread
+         * shared with the thread so it can be left to finish after Cancel()
+        */
+        struct cRecord_Job {
+            cRecord_Job(void);
+            ~cRecord_Job(void);
+
+            boost::filesystem::path m_filename;
+            cLevel_Snapshot* mp_snapshot;
+            // set if the snapshot was recorded
+            bool m_ok;
+            std::atomic<bool> m_done;
+        };
+        struct cDecode_Job {
+            cDecode_Job(void);
+            // deletes the images which were not taken
+            ~cDecode_Job(void);
+
+            std::vector<boost::filesystem::path> m_files;
+            std::vector<sf::Image*> m_images;
+            std::atomic<bool> m_done;
+        };
+
+        // Parse the level file into the snapshot
+        static void Record(std::shared_ptr<cRecord_Job> job);
+        // Decode the image files
+        static void Decode(std::shared_ptr<cDecode_Job> job);
+
+        // Start decoding the images of the snapshot
+        void Start_Decoding(void);
+        // Hand the decoded images to the video preload
+        void Add_Images(void);
+        /* Create the sprites of the next element
+         * returns false if the level could not be loaded
+        */
+        bool Load_Element(void);
+        // Delete the level and the loader
+        void Delete_Level(void);
+
+        std::string m_levelname;
+        boost::filesystem::path m_filename;
+
+        boost::thread m_record_thread;
+        std::shared_ptr<cRecord_Job> m_record_job;
+        boost::thread m_decode_thread;
+        std::shared_ptr<cDecode_Job> m_decode_job;
+        // set if the decoded images were added to the video preload
+        bool m_images_added;
+
+        cLevelLoader* mp_loader;
+        // index of the next snapshot element
+        size_t m_element_pos;
+        // set if loading failed and the level is loaded normally when entered
+        bool m_failed;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
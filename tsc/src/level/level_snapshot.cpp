@@ -0,0 +1,91 @@
+/***************************************************************************
+ * level_snapshot.cpp  -  Parsed level file kept in memory
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/global_basic.hpp"
+#include "../level/level_snapshot.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cLevel_Snapshot *** *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_Snapshot::cLevel_Snapshot(void)
+{
+    m_write_time = 0;
+}
+
+cLevel_Snapshot::~cLevel_Snapshot(void)
+{
+    //
+}
+
+void cLevel_Snapshot::Add_Element(const std::string& name, const XmlAttributes& properties)
+{
+    m_elements.push_back(cElement());
+    m_elements.back().m_name = name;
+    m_elements.back().m_properties = properties;
+}
+
+bool cLevel_Snapshot::Is_Valid(void) const
+{
+    boost::system::error_code ec;
+    const std::time_t write_time = fs::last_write_time(m_filename, ec);
+
+    return !ec && write_time == m_write_time;
+}
+
+void cLevel_Snapshot::Set_File(const fs::path& filename)
+{
+    boost::system::error_code ec;
+
+    m_filename = filename;
+    m_write_time = fs::last_write_time(m_filename, ec);
+}
+
+std::vector<fs::path> cLevel_Snapshot::Get_Image_Files(void) const
+{
+    std::vector<fs::path> files;
+    std::unordered_set<std::string> added;
+
+    for (ElementList::const_iterator itr = m_elements.begin(); itr != m_elements.end(); ++itr) {
+        for (XmlAttributes::const_iterator prop_itr = itr->m_properties.begin(); prop_itr != itr->m_properties.end(); ++prop_itr) {
+            const std::string& value = prop_itr->second;
+
+            // not an image file
+            if (value.size() < 5 || value.find_last_of('.') == std::string::npos) {
+                continue;
+            }
+
+            const std::string extension = value.substr(value.find_last_of('.'));
+
+            if (extension != ".png" && extension != ".settings") {
+                continue;
+            }
+
+            if (added.insert(value).second) {
+                files.push_back(utf8_to_path(value));
+            }
+        }
+    }
+
+    return files;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
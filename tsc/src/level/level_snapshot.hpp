@@ -0,0 +1,68 @@
+/***************************************************************************
+ * level_snapshot.hpp  -  Parsed level file kept in memory
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_SNAPSHOT_HPP
+#define TSC_LEVEL_SNAPSHOT_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/xml_attributes.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cLevel_Snapshot *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* The elements of a level file as the level loader got them
+     *
+     * Recorded by cLevelLoader while parsing the file. Loading the
+     * level again from it creates the same sprites without reading
+     * and parsing the file.
+    */
+    class cLevel_Snapshot {
+    public:
+        cLevel_Snapshot(void);
+        ~cLevel_Snapshot(void);
+
+        // Add a closed element with its properties
+        void Add_Element(const std::string& name, const XmlAttributes& properties);
+
+        /* Return true if the level file was not changed since it was recorded
+         * checks the modification time of the file
+        */
+        bool Is_Valid(void) const;
+        // Remember the modification time of the level file
+        void Set_File(const boost::filesystem::path& filename);
+        // Return the image files named in the element properties
+        std::vector<boost::filesystem::path> Get_Image_Files(void) const;
+
+        struct cElement {
+            std::string m_name;
+            XmlAttributes m_properties;
+        };
+
+        typedef vector<cElement> ElementList;
+        ElementList m_elements;
+        // content of the script element
+        std::string m_script;
+        // level file
+        boost::filesystem::path m_filename;
+        // modification time of the level file
+        std::time_t m_write_time;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -38,12 +38,14 @@ cBall::cBall(cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "ball")
 {
     cBall::Init();
+    Set_Ball_Type(FIREBALL_DEFAULT);
 }
 
 cBall::cBall(XmlAttributes& attributes, cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "ball")
 {
     cBall::Init();
+    Set_Ball_Type(FIREBALL_DEFAULT);
 
     // position
     Set_Pos(string_to_float(attributes["posx"]), string_to_float(attributes["posy"]), true);
@@ -85,7 +87,26 @@ void cBall::Init(void)
     m_fire_counter = 0.0f;
 
     Set_Origin(ARRAY_UNDEFINED, TYPE_UNDEFINED);
-    Set_Ball_Type(FIREBALL_DEFAULT);
+}
+
+cBall* cBall::Create(cSprite_Manager* sprite_manager, ball_effect type)
+{
+    cBall* ball = sprite_manager->m_ball_pool.Take();
+
+    if (ball) {
+        ball->Reset_Recycled(sprite_manager);
+        ball->cMovingSprite::Init();
+        ball->cBall::Init();
+    }
+    else {
+        ball = new cBall(sprite_manager);
+        sprite_manager->m_ball_pool.Count_Allocation();
+    }
+
+    ball->Set_Ball_Type(type);
+    ball->m_pool = &sprite_manager->m_ball_pool;
+
+    return ball;
 }
 
 cBall* cBall::Copy(void) const
@@ -124,14 +145,28 @@ void cBall::Load_From_Savegame(cSave_Level_Object* save_object)
 
 void cBall::Set_Ball_Type(ball_effect type)
 {
+    // explosion balls look the same
+    if (type == FIREBALL_EXPLOSION) {
+        type = FIREBALL_DEFAULT;
+    }
+    else if (type == ICEBALL_EXPLOSION) {
+        type = ICEBALL_DEFAULT;
+    }
+
+    // already loaded e.g. if recycled from the pool
+    if (!m_images.empty() && type == m_ball_type) {
+        Set_Image_Set("main");
+        return;
+    }
+
     Clear_Images();
 
-    if (type == FIREBALL_DEFAULT || type == FIREBALL_EXPLOSION) {
+    if (type == FIREBALL_DEFAULT) {
         Add_Image_Set("main", "animation/fireball/ball.imgset");
         Set_Image_Set("main");
         m_ball_type = FIREBALL_DEFAULT;
     }
-    else if (type == ICEBALL_DEFAULT || type == ICEBALL_EXPLOSION) {
+    else if (type == ICEBALL_DEFAULT) {
         Add_Image_Set("main", "animation/iceball/ball.imgset");
         Set_Image_Set("main");
         m_ball_type = ICEBALL_DEFAULT;
@@ -166,7 +201,7 @@ void cBall::Destroy(void)
     }
 
     if (m_ball_type == FIREBALL_DEFAULT) {
-        pActive_Animation_Manager->Add(new cAnimation_Fireball(m_sprite_manager, m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2));
+        pActive_Animation_Manager->Add(cAnimation_Fireball::Create(m_sprite_manager, m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2));
     }
     else if (m_ball_type == ICEBALL_DEFAULT) {
         // create animation
@@ -415,7 +450,7 @@ void cBall::Handle_Collision_Massive(cObjectCollision* collision)
             m_vely = -10.0f;
 
             // create animation
-            cAnimation_Fireball* anim = new cAnimation_Fireball(m_sprite_manager, m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2);
+            cAnimation_Fireball* anim = cAnimation_Fireball::Create(m_sprite_manager, m_pos_x + m_col_rect.m_w / 2, m_pos_y + m_col_rect.m_h / 2);
             anim->Set_Fading_Speed(3.0f);
             pActive_Animation_Manager->Add(anim);
         }
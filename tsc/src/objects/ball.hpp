@@ -33,6 +33,11 @@ namespace TSC {
         // destructor
         virtual ~cBall(void);
 
+        /* Return a ball from the pool of the sprite manager or a new one
+         * the ball is given back to the pool when it gets replaced or deleted
+        */
+        static cBall* Create(cSprite_Manager* sprite_manager, ball_effect type);
+
         // init defaults
         void Init(void);
         // copy
@@ -47,7 +52,9 @@ namespace TSC {
             return mrb_obj_value(Data_Wrap_Struct(p_state, mrb_class_get(p_state, "Ball"), &Scripting::rtTSC_Scriptable, this));
         }
 
-        // set type
+        /* set type
+         * keeps the images if they are already loaded for the type
+        */
         void Set_Ball_Type(ball_effect type);
         // set origin
         void Set_Origin(ArrayType origin_array, SpriteType origin_type);
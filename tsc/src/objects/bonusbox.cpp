@@ -69,6 +69,7 @@ void cBonusBox::Init(void)
     m_type = TYPE_BONUS_BOX;
     m_force_best_item = 0;
     m_camera_range = 5000;
+    m_update_range_gated = 1;
     m_can_be_on_ground = 0;
 
     Set_Animation_Type("Bonus");
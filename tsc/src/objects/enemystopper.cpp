@@ -67,6 +67,7 @@ void cEnemyStopper::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     m_editor_color = Color(static_cast<uint8_t>(0), 0, 255, 128);
 }
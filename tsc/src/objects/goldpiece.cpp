@@ -60,6 +60,7 @@ void cGoldpiece::Init(DefaultColor color /* = COL_YELLOW */)
     m_type = TYPE_GOLDPIECE;
     m_pos_z = 0.041f;
     m_can_be_on_ground = 0;
+    m_update_range_gated = 1;
 
     Set_Gold_Color(color);
 }
@@ -142,7 +143,7 @@ void cGoldpiece::Activate(void)
     }
 
     // animation
-    cAnimation_Goldpiece* anim = new cAnimation_Goldpiece(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 10), m_pos_y + (m_col_rect.m_h / 10));
+    cAnimation_Goldpiece* anim = cAnimation_Goldpiece::Create(m_sprite_manager, m_pos_x + (m_col_rect.m_w / 10), m_pos_y + (m_col_rect.m_h / 10));
 
     // gold
     unsigned int points = 0;
@@ -243,6 +244,8 @@ cJGoldpiece::cJGoldpiece(cSprite_Manager* sprite_manager, DefaultColor color /*
 {
     m_type = TYPE_JUMPING_GOLDPIECE;
     Set_Spawned(1);
+    // updated until it stops jumping
+    m_update_range_gated = 0;
 
     m_vely = -18.0f;
 }
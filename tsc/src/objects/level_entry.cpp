@@ -78,6 +78,7 @@ void cLevel_Entry::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     m_entry_type = LEVEL_ENTRY_WARP;
     Set_Direction(DIR_UP);
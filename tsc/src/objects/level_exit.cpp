@@ -116,6 +116,7 @@ void cLevel_Exit::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     m_exit_type = LEVEL_EXIT_BEAM;
     m_exit_motion = CAMERA_MOVE_FLY;
@@ -114,6 +114,7 @@ void cMoving_Platform::Init(void)
     m_pos_z = 0.085f;
     m_gravity_max = 25.0f;
     m_can_be_on_ground = 0;
+    m_update_range_gated = 1;
 
     m_camera_range = 3000;
     m_can_be_ground = 1;
@@ -793,6 +794,7 @@ void cMoving_Platform::Update_Rect(void)
     // set height
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 }
 
 void cMoving_Platform::Update_Velocity(void)
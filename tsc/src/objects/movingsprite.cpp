@@ -228,7 +228,150 @@ void cMovingSprite::Move(float move_x, float move_y, bool real /* = 0 */)
     Check_And_Handle_Out_Of_Level(move_x, move_y);
 }
 
-cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal /* = 0 */)
+// iteration used for never reaching an object
+static const float col_steps_never = 1.0e9f;
+
+/* Get the Col_Move_in_Steps iterations in which the moving rect overlaps the object on one axis
+ * iteration n moves from step n - 1 to step n
+ * pos, size : moving rect
+ * step : step size or 0 if not moving
+ * steps : number of steps until the final position is reached
+ * returns false if it never overlaps
+*/
+static bool Get_Col_Step_Overlap(float pos, float size, float step, float steps, float obj_pos, float obj_size, float& start, float& end)
+{
+    // small tolerance as the steps are added up
+    const float min_pos = obj_pos - size - 0.1f;
+    const float max_pos = obj_pos + obj_size + 0.1f;
+
+    if (Is_Float_Equal(step, 0.0f)) {
+        if (pos < min_pos || pos > max_pos) {
+            return 0;
+        }
+
+        start = 0.0f;
+        end = col_steps_never;
+        return 1;
+    }
+
+    float t1 = (min_pos - pos) / step;
+    float t2 = (max_pos - pos) / step;
+
+    if (t1 > t2) {
+        std::swap(t1, t2);
+    }
+
+    if (t2 < 0.0f || t1 > steps) {
+        return 0;
+    }
+
+    start = t1 > 0.0f ? t1 : 0.0f;
+    // stays there after the final position
+    end = t2 >= steps ? col_steps_never : t2;
+    return 1;
+}
+
+void cMovingSprite::Col_Skip_Free_Steps(float& step_size_x, float& step_size_y, bool& move_x_valid, bool& move_y_valid, float final_pos_x, float final_pos_y, const cSprite_List& sprite_list)
+{
+    if (!move_x_valid && !move_y_valid) {
+        return;
+    }
+
+    // an axis without a step is handled by the next iteration
+    if ((move_x_valid && Is_Float_Equal(step_size_x, 0.0f)) || (move_y_valid && Is_Float_Equal(step_size_y, 0.0f))) {
+        return;
+    }
+
+    // steps until the final position is reached
+    float steps_x = 0.0f;
+    float steps_y = 0.0f;
+
+    if (move_x_valid) {
+        steps_x = ceil((final_pos_x - m_pos_x) / step_size_x);
+
+        if (steps_x < 1.0f) {
+            steps_x = 1.0f;
+        }
+    }
+    if (move_y_valid) {
+        steps_y = ceil((final_pos_y - m_pos_y) / step_size_y);
+
+        if (steps_y < 1.0f) {
+            steps_y = 1.0f;
+        }
+    }
+
+    // first iteration which could touch an object
+    float first_contact = col_steps_never;
+
+    for (cSprite_List::const_iterator itr = sprite_list.begin(); itr != sprite_list.end(); ++itr) {
+        const cSprite* obj = (*itr);
+
+        // ignored by Collision_Check
+        if (this == obj || obj->m_auto_destroy || obj->m_sprite_array == ARRAY_UNDEFINED || obj->m_sprite_array == ARRAY_HUD || obj->m_sprite_array == ARRAY_ANIM) {
+            continue;
+        }
+
+        float x_start, x_end, y_start, y_end;
+
+        if (!Get_Col_Step_Overlap(m_col_rect.m_x, m_col_rect.m_w, move_x_valid ? step_size_x : 0.0f, steps_x, obj->m_col_rect.m_x, obj->m_col_rect.m_w, x_start, x_end)) {
+            continue;
+        }
+        if (!Get_Col_Step_Overlap(m_col_rect.m_y, m_col_rect.m_h, move_y_valid ? step_size_y : 0.0f, steps_y, obj->m_col_rect.m_y, obj->m_col_rect.m_h, y_start, y_end)) {
+            continue;
+        }
+
+        // both axes overlap at the same time
+        const float start = x_start > y_start ? x_start : y_start;
+        const float end = x_end < y_end ? x_end : y_end;
+        // iteration n checks the positions between step n - 1 and n
+        float contact = ceil(start);
+
+        if (contact < 1.0f) {
+            contact = 1.0f;
+        }
+
+        if (contact > end + 1.0f) {
+            continue;
+        }
+
+        if (contact < first_contact) {
+            first_contact = contact;
+        }
+    }
+
+    // iterations without any contact
+    const float free_steps = first_contact - 1.0f;
+
+    if (free_steps < 1.0f) {
+        return;
+    }
+
+    if (move_x_valid) {
+        if (free_steps >= steps_x) {
+            m_pos_x = final_pos_x;
+            move_x_valid = 0;
+            step_size_x = 0.0f;
+        }
+        else {
+            m_pos_x += step_size_x * free_steps;
+        }
+    }
+    if (move_y_valid) {
+        if (free_steps >= steps_y) {
+            m_pos_y = final_pos_y;
+            move_y_valid = 0;
+            step_size_y = 0.0f;
+        }
+        else {
+            m_pos_y += step_size_y * free_steps;
+        }
+    }
+
+    Update_Position_Rect();
+}
+
+cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List& sprite_list, bool stop_on_internal /* = 0 */)
 {
     if (sprite_list.empty()) {
         cSprite::Move(final_pos_x - m_pos_x, final_pos_y - m_pos_y, 1);
@@ -240,11 +383,20 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
 
     bool move_x_valid = 1;
     bool move_y_valid = 1;
+    // set if nothing was touched in the last iteration
+    bool skip_free_steps = 1;
 
     /* Checks in both directions simultaneously
      * if a collision occurs it saves the direction
     */
     while (move_x_valid || move_y_valid) {
+        // jump to the first step which could touch an object
+        if (skip_free_steps) {
+            Col_Skip_Free_Steps(step_size_x, step_size_y, move_x_valid, move_y_valid, final_pos_x, final_pos_y, sprite_list);
+        }
+
+        skip_free_steps = 1;
+
         if (move_x_valid) {
             // nothing to do
             if (Is_Float_Equal(step_size_x, 0.0f)) {
@@ -299,6 +451,7 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             if (col_list_temp->size()) {
                 col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
                 col_list_temp->objects.clear();
+                skip_free_steps = 0;
             }
 
             delete col_list_temp;
@@ -376,6 +529,7 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             if (col_list_temp->size()) {
                 col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
                 col_list_temp->objects.clear();
+                skip_free_steps = 0;
             }
 
             delete col_list_temp;
@@ -442,7 +596,8 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
             complete_rect.m_h -= move_y;
         }
 
-        cSprite_List sprite_list;
+        cSprite_List& sprite_list = m_col_move_objects;
+        sprite_list.clear();
         m_sprite_manager->Get_Colliding_Objects(sprite_list, complete_rect, 1, this);
 
         // step size
@@ -959,6 +1114,31 @@ void cMovingSprite::Collide_Move(void)
     Move_With_Ground();
 }
 
+bool cMovingSprite::Is_Collision_Sleeping(void) const
+{
+    // pending collisions
+    if (!m_collisions.empty()) {
+        return 0;
+    }
+
+    // Collide_Move() returns early
+    if (!m_valid_update || !Is_In_Range()) {
+        return 1;
+    }
+
+    // moving
+    if (!Is_Float_Equal(m_velx, 0.0f) || !Is_Float_Equal(m_vely, 0.0f)) {
+        return 0;
+    }
+
+    // could be moved by Move_With_Ground()
+    if (m_ground_object && (m_ground_object->m_sprite_array == ARRAY_ACTIVE || m_ground_object->m_sprite_array == ARRAY_ENEMY)) {
+        return 0;
+    }
+
+    return 1;
+}
+
 void cMovingSprite::Move_With_Ground(void)
 {
     if (!m_ground_object || (m_ground_object->m_sprite_array != ARRAY_ACTIVE && m_ground_object->m_sprite_array != ARRAY_ENEMY)) {  // || m_ground_object->sprite_array == ARRAY_MASSIVE
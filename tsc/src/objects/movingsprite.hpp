@@ -233,6 +233,10 @@ namespace TSC {
 
         // default collision and movement handling
         virtual void Collide_Move(void);
+        /* Returns true if Collide_Move() and Handle_Collisions() would do nothing this frame
+         * awake if moving, carried by a moving ground object, in camera range or with pending collisions
+        */
+        virtual bool Is_Collision_Sleeping(void) const;
 
         /* Freeze for the given time
         */
@@ -305,10 +309,18 @@ namespace TSC {
     private:
         /* moves in steps and checks in both directions simultaneous
          * returns the found collisions
-         * sprite_list : objects to check
+         * sprite_list : objects to check, internal collisions get removed if stop_on_internal is not set
          * stop_on_internal : if set stops moving if internal collision was found
         */
-        cObjectCollisionType* Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal = 0);
+        cObjectCollisionType* Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List& sprite_list, bool stop_on_internal = 0);
+        /* moves over the Col_Move_in_Steps iterations which can not touch any object
+         * the first contact is calculated from the motion of the collision rect
+         * and the axes which reach their final position are invalidated
+        */
+        void Col_Skip_Free_Steps(float& step_size_x, float& step_size_y, bool& move_x_valid, bool& move_y_valid, float final_pos_x, float final_pos_y, const cSprite_List& sprite_list);
+
+        // possible colliding objects of Col_Move which keeps its capacity
+        cSprite_List m_col_move_objects;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -114,23 +114,7 @@ cPath* cPath_State::Get_Path_Object(const std::string& identifier)
         return NULL;
     }
 
-    // Search for path
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
-
-        if (obj->m_type != TYPE_PATH || obj->m_auto_destroy) {
-            continue;
-        }
-
-        cPath* path = static_cast<cPath*>(obj);
-
-        // found
-        if (path->m_identifier.compare(identifier) == 0) {
-            return path;
-        }
-    }
-
-    return NULL;
+    return static_cast<cPath*>(m_sprite_manager->Get_Path_by_Identifier(identifier));
 }
 
 void cPath_State::Set_Path_Identifier(const std::string& path)
@@ -488,6 +472,7 @@ void cPath::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     m_rewind = 0;
     m_editor_color = Color(static_cast<uint8_t>(100), 150, 200, 128);
@@ -548,6 +533,10 @@ void cPath::Set_Identifier(const std::string& identifier)
 {
     m_identifier = identifier;
 
+    if (m_sprite_manager) {
+        m_sprite_manager->Invalidate_Path_Index();
+    }
+
     // remove linked objects
     Remove_Links();
 
@@ -558,32 +547,37 @@ void cPath::Set_Identifier(const std::string& identifier)
     /* search for linked objects
      * needed to update the links
     */
-    for (cSprite_List::iterator itr = pActive_Level->m_sprite_manager->objects.begin(); itr != pActive_Level->m_sprite_manager->objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    const cSprite_List& static_enemies = pActive_Level->m_sprite_manager->Get_Objects_by_Type(TYPE_STATIC_ENEMY);
 
-        if (obj->m_auto_destroy) {
+    for (cSprite_List::const_iterator itr = static_enemies.begin(); itr != static_enemies.end(); ++itr) {
+        cStaticEnemy* static_enemy = static_cast<cStaticEnemy*>(*itr);
+
+        if (static_enemy->m_auto_destroy) {
             continue;
         }
 
-        if (obj->m_type == TYPE_STATIC_ENEMY) {
-            cStaticEnemy* static_enemy = static_cast<cStaticEnemy*>(obj);
+        // found
+        if (static_enemy->m_path_state.m_path_identifier.compare(m_identifier) == 0) {
+            // link to me
+            static_enemy->Init_Links();
+            //static_enemy->m_path_state.Set_Path_Identifier( m_identifier );
+        }
+    }
+
+    const cSprite_List& moving_platforms = pActive_Level->m_sprite_manager->Get_Objects_by_Type(TYPE_MOVING_PLATFORM);
 
-            // found
-            if (static_enemy->m_path_state.m_path_identifier.compare(m_identifier) == 0) {
-                // link to me
-                static_enemy->Init_Links();
-                //static_enemy->m_path_state.Set_Path_Identifier( m_identifier );
-            }
+    for (cSprite_List::const_iterator itr = moving_platforms.begin(); itr != moving_platforms.end(); ++itr) {
+        cMoving_Platform* moving_platform = static_cast<cMoving_Platform*>(*itr);
+
+        if (moving_platform->m_auto_destroy) {
+            continue;
         }
-        else if (obj->m_type == TYPE_MOVING_PLATFORM) {
-            cMoving_Platform* moving_platform = static_cast<cMoving_Platform*>(obj);
-
-            // found
-            if (moving_platform->m_path_state.m_path_identifier.compare(m_identifier) == 0) {
-                // link to me
-                moving_platform->Init_Links();
-                //moving_platform->m_path_state.Set_Path_Identifier( m_identifier );
-            }
+
+        // found
+        if (moving_platform->m_path_state.m_path_identifier.compare(m_identifier) == 0) {
+            // link to me
+            moving_platform->Init_Links();
+            //moving_platform->m_path_state.Set_Path_Identifier( m_identifier );
         }
     }
 }
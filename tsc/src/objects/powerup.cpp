@@ -180,6 +180,7 @@ void cMushroom::Init(void)
     m_velx = 3.0f;
     m_direction = DIR_RIGHT;
     m_camera_range = 5000;
+    m_update_range_gated = 1;
 
     m_type = TYPE_UNDEFINED;
     Set_Type(TYPE_MUSHROOM_DEFAULT);
@@ -244,7 +245,7 @@ void cMushroom::Set_Type(SpriteType new_type)
         return;
     }
 
-    m_type = new_type;
+    Set_Sprite_Type(new_type);
     Set_Image_Set("main", 1);
 }
 
@@ -440,6 +441,7 @@ void cFirePlant::Init(void)
 {
     m_type = TYPE_FIREPLANT;
     m_can_be_on_ground = 0;
+    m_update_range_gated = 1;
     m_pos_z = 0.051f;
 
     Clear_Images();
@@ -544,6 +546,7 @@ void cMoon::Init(void)
 {
     m_type = TYPE_MOON;
     m_can_be_on_ground = 0;
+    m_update_range_gated = 1;
     m_pos_z = 0.052f;
 
     Clear_Images();
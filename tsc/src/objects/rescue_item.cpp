@@ -132,6 +132,6 @@ void cRescueItem::Set_Item_Type(SpriteType type)
         Add_Image_Set("main", "game/items/berry_big.imgset");
     }
 
-    m_type = type;
+    Set_Sprite_Type(type);
     Set_Image_Set("main", 1);
 }
@@ -100,6 +100,7 @@ void cSecret_Area::Set_Rect(GL_rect rect, bool new_start_pos /* = false */)
     m_col_rect.m_h   = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 }
 
 void cSecret_Area::Update(void)
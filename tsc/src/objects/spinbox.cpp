@@ -48,6 +48,7 @@ void cSpinBox::Init(void)
     box_type = m_type;
     m_name = _("Spinbox");
     m_camera_range = 5000;
+    m_update_range_gated = 1;
     m_can_be_on_ground = 0;
 
     m_spin_counter = 0.0f;
@@ -405,11 +405,24 @@ void cSprite::Init(void)
     m_pos_z = 0.0f;
     m_editor_pos_z = 0.0f;
 
+    m_interp_pos_x = 0.0f;
+    m_interp_pos_y = 0.0f;
+    m_interp_real_pos_x = 0.0f;
+    m_interp_real_pos_y = 0.0f;
+    m_interp_stored = 0;
+    m_interp_applied = 0;
+
     m_massive_type = MASS_PASSIVE;
     m_active = 1;
     m_spawned = 0;
     m_suppress_save = 0;
     m_camera_range = 1000;
+    m_update_range_gated = 0;
+    m_update_region_active = 1;
+    m_bucket_type = TYPE_UNDEFINED;
+    m_bucket_array = ARRAY_UNDEFINED;
+    m_type_bucket_pos = 0;
+    m_array_bucket_pos = 0;
     m_can_be_ground = 0;
     m_disallow_managed_delete = 0;
 
@@ -436,6 +449,20 @@ void cSprite::Init(void)
     m_valid_update = 1;
 
     m_uid = -1;
+
+    m_pool = NULL;
+    m_pool_next = NULL;
+}
+
+void cSprite::Reset_Recycled(cSprite_Manager* sprite_manager)
+{
+    Clear_Collisions();
+    clear_event_handlers();
+    Set_Sprite_Manager(sprite_manager);
+    // deletes an owned image
+    Set_Image(NULL, 1);
+
+    cSprite::Init();
 }
 
 cSprite* cSprite::Copy(void) const
@@ -652,6 +679,15 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
 void cSprite::Set_Sprite_Type(SpriteType type)
 {
     m_type = type;
+
+    Update_Sprite_Buckets();
+}
+
+void cSprite::Set_Sprite_Array(ArrayType sprite_array)
+{
+    m_sprite_array = sprite_array;
+
+    Update_Sprite_Buckets();
 }
 
 /**
@@ -725,6 +761,50 @@ void cSprite::Set_Pos_Y(float y, bool new_startpos /* = 0 */)
     Update_Position_Rect();
 }
 
+void cSprite::Store_Interpolation_Pos(void)
+{
+    m_interp_pos_x = m_pos_x;
+    m_interp_pos_y = m_pos_y;
+    m_interp_stored = 1;
+}
+
+void cSprite::Apply_Interpolation_Pos(const float alpha)
+{
+    if (!m_interp_stored || m_interp_applied) {
+        return;
+    }
+
+    // not moved
+    if (Is_Float_Equal(m_interp_pos_x, m_pos_x) && Is_Float_Equal(m_interp_pos_y, m_pos_y)) {
+        return;
+    }
+
+    // teleported e.g. by a level entry, do not draw it between both positions
+    if (fabs(m_pos_x - m_interp_pos_x) > 100.0f || fabs(m_pos_y - m_interp_pos_y) > 100.0f) {
+        return;
+    }
+
+    m_interp_real_pos_x = m_pos_x;
+    m_interp_real_pos_y = m_pos_y;
+    m_interp_applied = 1;
+
+    m_pos_x = m_interp_pos_x + ((m_interp_real_pos_x - m_interp_pos_x) * alpha);
+    m_pos_y = m_interp_pos_y + ((m_interp_real_pos_y - m_interp_pos_y) * alpha);
+    Update_Position_Rect();
+}
+
+void cSprite::Restore_Interpolation_Pos(void)
+{
+    if (!m_interp_applied) {
+        return;
+    }
+
+    m_pos_x = m_interp_real_pos_x;
+    m_pos_y = m_interp_real_pos_y;
+    m_interp_applied = 0;
+    Update_Position_Rect();
+}
+
 void cSprite::Set_Active(bool enabled)
 {
     // already set
@@ -939,11 +1019,32 @@ void cSprite::Update_Position_Rect(void)
         // Do not use m_start_pos_x/m_start_pos_y because col_rect is not the editor/start rect
         m_col_rect.m_x = m_pos_x + m_col_pos.m_x; // todo : startcol_pos ?
         m_col_rect.m_y = m_pos_y + m_col_pos.m_y;
+
+        Update_Editor_Index();
+    }
+
+    // moved while outside of the update region
+    if (!m_update_region_active && m_sprite_manager) {
+        m_sprite_manager->Invalidate_Update_Region();
     }
 
     Update_Valid_Draw();
 }
 
+void cSprite::Update_Editor_Index(void)
+{
+    if (editor_enabled && m_sprite_manager) {
+        m_sprite_manager->Update_Editor_Index(this);
+    }
+}
+
+void cSprite::Update_Sprite_Buckets(void)
+{
+    if (m_sprite_manager) {
+        m_sprite_manager->Update_Sprite_Buckets(this);
+    }
+}
+
 void cSprite::Update_Valid_Draw(void)
 {
     m_valid_draw = Is_Draw_Valid();
@@ -1260,27 +1361,27 @@ void cSprite::Set_Massive_Type(MassiveType type)
 
     // set massive-type z position
     if (m_massive_type == MASS_MASSIVE) {
-        m_sprite_array = ARRAY_MASSIVE;
+        Set_Sprite_Array(ARRAY_MASSIVE);
         m_pos_z = m_pos_z_massive_start;
         m_can_be_ground = true;
     }
     else if (m_massive_type == MASS_PASSIVE) {
-        m_sprite_array = ARRAY_PASSIVE;
+        Set_Sprite_Array(ARRAY_PASSIVE);
         m_pos_z = m_pos_z_passive_start;
         m_can_be_ground = false;
     }
     else if (m_massive_type == MASS_FRONT_PASSIVE) {
-        m_sprite_array = ARRAY_PASSIVE;
+        Set_Sprite_Array(ARRAY_PASSIVE);
         m_pos_z = m_pos_z_front_passive_start;
         m_can_be_ground = false;
     }
     else if (m_massive_type == MASS_HALFMASSIVE) {
-        m_sprite_array = ARRAY_ACTIVE;
+        Set_Sprite_Array(ARRAY_ACTIVE);
         m_pos_z = m_pos_z_halfmassive_start;
         m_can_be_ground = true;
     }
     else if (m_massive_type == MASS_CLIMBABLE) {
-        m_sprite_array = ARRAY_ACTIVE;
+        Set_Sprite_Array(ARRAY_ACTIVE);
         m_pos_z = m_pos_z_halfmassive_start;
         m_can_be_ground = false;
     }
@@ -1414,6 +1515,11 @@ void cSprite::Destroy(void)
     m_valid_draw = 0;
     m_valid_update = 0;
     Set_Image(NULL, 1);
+
+    // the next added sprite can take its place
+    if (m_sprite_manager) {
+        m_sprite_manager->Sprite_Destroyed(this);
+    }
 }
 
 /**
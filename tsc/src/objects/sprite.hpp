@@ -125,6 +125,11 @@ namespace TSC {
 
         // initialize defaults
         virtual void Init(void);
+        /* Reset to the state after construction for reuse from a sprite pool
+         * the images of the image set are kept so they do not need to be loaded again
+         * derived classes call their own Init() afterwards
+        */
+        void Reset_Recycled(cSprite_Manager* sprite_manager);
         /* late initialization
          * this needs linked objects to be already loaded
         */
@@ -157,6 +162,8 @@ namespace TSC {
 
         // Set the sprite type
         void Set_Sprite_Type(SpriteType type);
+        // Set the sprite array
+        void Set_Sprite_Array(ArrayType sprite_array);
 
         /* Set if the camera should be ignored
          * default : disabled
@@ -183,6 +190,17 @@ namespace TSC {
         void Set_Pos(float x, float y, bool new_startpos = 0);
         void Set_Pos_X(float x, bool new_startpos = 0);
         void Set_Pos_Y(float y, bool new_startpos = 0);
+
+        // Remember the current position as start of the drawing interpolation
+        void Store_Interpolation_Pos(void);
+        /* Move to the position between the interpolation start and the current position
+         * alpha is the fraction of a fixed timestep passed since the last game logic step
+         * Restore_Interpolation_Pos() must be called after drawing
+        */
+        void Apply_Interpolation_Pos(const float alpha);
+        // Move back to the real position after drawing
+        void Restore_Interpolation_Pos(void);
+
         // Set if active
         virtual void Set_Active(bool enabled);
         /* Set the shadow
@@ -362,9 +380,26 @@ namespace TSC {
 
         // default collision and movement handling
         virtual void Collide_Move(void) {};
+        /* Returns true if Collide_Move() and Handle_Collisions() would do nothing this frame
+         * the sprite manager skips sleeping sprites
+         * this is checked every frame so a received collision wakes the sprite up
+        */
+        virtual bool Is_Collision_Sleeping(void) const
+        {
+            return m_collisions.empty();
+        };
 
         // Update the position rect values
         void Update_Position_Rect(void);
+        /* Update the editor index of the sprite manager after the start rect changed
+         * only needed in the editor as the index is only used there
+        */
+        void Update_Editor_Index(void);
+        /* Move the sprite to the type and array buckets of the sprite manager
+         * Set_Sprite_Type() and Set_Sprite_Array() call this, m_type and
+         * m_sprite_array must not be assigned directly once the sprite is managed
+        */
+        void Update_Sprite_Buckets(void);
         // default update, derived updates should not call this again if they also call Update_Animation()
         virtual void Update(void) { Update_Animation(); };
         /* late update
@@ -475,6 +510,16 @@ namespace TSC {
         /// start position
         float m_start_pos_x;
         float m_start_pos_y;
+        /// position before the last fixed timestep (drawing interpolation start)
+        float m_interp_pos_x;
+        float m_interp_pos_y;
+        /// real position while drawing an interpolated position
+        float m_interp_real_pos_x;
+        float m_interp_real_pos_y;
+        /// if the interpolation start is set
+        bool m_interp_stored;
+        /// if an interpolated position is applied
+        bool m_interp_applied;
         /** editor z position
          * it's only used if not 0
         */
@@ -545,6 +590,16 @@ namespace TSC {
         bool m_suppress_save;
         /// maximum distance to the camera to get updated
         unsigned int m_camera_range;
+        /// set if Update() does nothing when not in camera range or not visible on screen
+        bool m_update_range_gated;
+        /// false if the sprite manager found it too far away from the camera to need Update()
+        bool m_update_region_active;
+        /// type and array the sprite manager buckets hold the sprite under
+        SpriteType m_bucket_type;
+        ArrayType m_bucket_array;
+        /// position in these buckets
+        unsigned int m_type_bucket_pos;
+        unsigned int m_array_bucket_pos;
         /// can be used as ground object
         bool m_can_be_ground;
 
@@ -571,6 +626,11 @@ namespace TSC {
         /// ID to uniquely identify this sprite (UIDS[idhere] uses this)
         int m_uid;
 
+        /// pool this sprite is given back to instead of being deleted or NULL
+        cSprite_Pool_Base* m_pool;
+        /// next free sprite while it is in the pool
+        cSprite* m_pool_next;
+
         static const float m_pos_z_passive_start; ///< Start Z position for passive elements
         static const float m_pos_z_massive_start; ///< Start Z position for massive elements
         static const float m_pos_z_front_passive_start; ///< Start Z position for front passive elements
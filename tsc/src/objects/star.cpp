@@ -49,6 +49,7 @@ void cjStar::Init(void)
 {
     m_type = TYPE_STAR;
     m_pos_z = 0.053f;
+    m_update_range_gated = 1;
 
     m_direction = DIR_RIGHT;
     m_anim_counter = 0;
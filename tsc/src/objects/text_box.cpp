@@ -20,6 +20,7 @@
 #include "../core/i18n.hpp"
 #include "../user/preferences.hpp"
 #include "../input/joystick.hpp"
+#include "../input/input_recorder.hpp"
 #include "../core/main.hpp"
 #include "../input/keyboard.hpp"
 #include "../core/i18n.hpp"
@@ -61,6 +62,7 @@ void cText_Box::Init(void)
     m_type = TYPE_TEXT_BOX;
     box_type = m_type;
     m_can_be_on_ground = 0;
+    m_update_range_gated = 1;
     m_name = _("Text Box");
 
     // default is infinite times activate-able
@@ -145,7 +147,9 @@ void cText_Box::Activate(void)
     bool display = 1;
 
     while (display) {
-        while (pVideo->PollEvent(input_event)) {
+        pInput_Recorder->Next_Tick();
+
+        while (pInput_Recorder->Poll_Event(input_event)) {
             if (input_event.type == sf::Event::KeyPressed) {
 
                 // exit keys
@@ -178,11 +182,11 @@ void cText_Box::Activate(void)
         }
 
         // down
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             editbox->getVertScrollbar()->setScrollPosition(editbox->getVertScrollbar()->getScrollPosition() + (editbox->getVertScrollbar()->getStepSize() * 0.25f * pFramerate->m_speed_factor));
         }
         // up
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             editbox->getVertScrollbar()->setScrollPosition(editbox->getVertScrollbar()->getScrollPosition() - (editbox->getVertScrollbar()->getStepSize() * 0.25f * pFramerate->m_speed_factor));
         }
 
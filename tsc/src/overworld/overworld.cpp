@@ -174,6 +174,7 @@ void cOverworld::Init()
 
     m_player_start_waypoint = 0;
     m_player_moving_state = STA_STAY;
+    m_waypoint_index_dirty = 1;
 }
 
 void cOverworld::Replace_Description(cOverworld_description* p_desc)
@@ -212,6 +213,7 @@ void cOverworld::Unload(void)
     m_sprite_manager->Delete_All();
     // Waypoints
     m_waypoints.clear();
+    Invalidate_Waypoint_Index();
     // Layer
     m_layer->Delete_All();
     // animations
@@ -460,7 +462,7 @@ void cOverworld::Draw_Layer_1(void)
 
 void cOverworld::Process_Input()
 {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::O) && sf::Keyboard::isKeyPressed(sf::Keyboard::M) && !editor_world_enabled) {
+    if (pKeyboard->Is_Key_Down(sf::Keyboard::O) && pKeyboard->Is_Key_Down(sf::Keyboard::M) && !editor_world_enabled) {
         if (m_cheat_counter > 50.0f) {
             // all waypoint access
             gp_hud->Set_Text(_("Omega Mode unlocks all waypoints"));
@@ -485,6 +487,7 @@ void cOverworld::Update(void)
         m_sprite_manager->Update_Items();
         // Player
         pOverworld_Player->Update();
+        pOverworld_Player->Update_Level_Prefetch();
         // Animations
         m_animation_manager->Update();
     }
@@ -517,16 +520,16 @@ void cOverworld::Update_Camera(void)
 
     // todo : move to a Process_Input function
     if (pOverworld_Manager->m_camera_mode) {
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_right) || pJoystick->Right()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_right) || pJoystick->Right()) {
             pOverworld_Manager->m_camera->Move(pFramerate->m_speed_factor * 15, 0);
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_left) || pJoystick->Left()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_left) || pJoystick->Left()) {
             pOverworld_Manager->m_camera->Move(pFramerate->m_speed_factor * -15, 0);
         }
-        if (sf::Keyboard::isKeyPressed(pPreferences->m_key_up) || pJoystick->Up()) {
+        if (pKeyboard->Is_Key_Down(pPreferences->m_key_up) || pJoystick->Up()) {
             pOverworld_Manager->m_camera->Move(0, pFramerate->m_speed_factor * -15);
         }
-        else if (sf::Keyboard::isKeyPressed(pPreferences->m_key_down) || pJoystick->Down()) {
+        else if (pKeyboard->Is_Key_Down(pPreferences->m_key_down) || pJoystick->Down()) {
             pOverworld_Manager->m_camera->Move(0, pFramerate->m_speed_factor * 15);
         }
     }
@@ -681,6 +684,16 @@ bool cOverworld::Joy_Button_Up(unsigned int button)
 
 cWaypoint* cOverworld::Get_Waypoint(const std::string& name)
 {
+    if (Update_Waypoint_Index()) {
+        std::unordered_map<std::string, unsigned int>::const_iterator itr = m_waypoint_destination_index.find(name);
+
+        if (itr == m_waypoint_destination_index.end()) {
+            return NULL;
+        }
+
+        return m_waypoints[itr->second];
+    }
+
     for (WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr) {
         cWaypoint* obj = (*itr);
 
@@ -716,6 +729,17 @@ int cOverworld::Get_Level_Waypoint_Num(std::string level_name)
 
 int cOverworld::Get_Waypoint_Num(const std::string& name)
 {
+    if (Update_Waypoint_Index()) {
+        std::unordered_map<std::string, unsigned int>::const_iterator itr = m_waypoint_destination_index.find(name);
+
+        if (itr == m_waypoint_destination_index.end()) {
+            // not found
+            return -1;
+        }
+
+        return itr->second;
+    }
+
     int count = 0;
 
     // search waypoint
@@ -734,14 +758,32 @@ int cOverworld::Get_Waypoint_Num(const std::string& name)
     return -1;
 }
 
-int cOverworld::Get_Waypoint_Collision(const GL_rect& rect_2)
+int cOverworld::Get_Waypoint_Collision(const GL_rect& rect_2, int ignore_num /* = -1 */)
 {
+    if (Update_Waypoint_Index()) {
+        m_waypoint_candidates.clear();
+        m_waypoint_rect_index.Query(rect_2, m_waypoint_candidates);
+
+        // candidates are sorted by array number
+        for (vector<unsigned int>::const_iterator itr = m_waypoint_candidates.begin(); itr != m_waypoint_candidates.end(); ++itr) {
+            if (static_cast<int>(*itr) == ignore_num) {
+                continue;
+            }
+
+            if (rect_2.Intersects(m_waypoints[*itr]->m_rect)) {
+                return *itr;
+            }
+        }
+
+        return -1;
+    }
+
     int count = 0;
 
     for (WaypointList::iterator itr = m_waypoints.begin(); itr != m_waypoints.end(); ++itr) {
         cWaypoint* obj = (*itr);
 
-        if (rect_2.Intersects(obj->m_rect)) {
+        if (count != ignore_num && rect_2.Intersects(obj->m_rect)) {
             return count;
         }
 
@@ -751,6 +793,38 @@ int cOverworld::Get_Waypoint_Collision(const GL_rect& rect_2)
     return -1;
 }
 
+void cOverworld::Invalidate_Waypoint_Index(void)
+{
+    m_waypoint_index_dirty = 1;
+}
+
+bool cOverworld::Update_Waypoint_Index(void)
+{
+    // waypoints are moved and renamed without notice in the editor
+    if (editor_world_enabled) {
+        m_waypoint_index_dirty = 1;
+        return 0;
+    }
+
+    if (!m_waypoint_index_dirty) {
+        return 1;
+    }
+
+    m_waypoint_rect_index.Clear();
+    m_waypoint_destination_index.clear();
+
+    for (unsigned int i = 0; i < m_waypoints.size(); i++) {
+        cWaypoint* obj = m_waypoints[i];
+
+        m_waypoint_rect_index.Insert(obj->m_rect, i);
+        // the first waypoint wins as with the linear search
+        m_waypoint_destination_index.insert(std::make_pair(obj->m_destination, i));
+    }
+
+    m_waypoint_index_dirty = 0;
+    return 1;
+}
+
 int cOverworld::Get_Last_Valid_Waypoint(void)
 {
     // no waypoints
@@ -153,9 +153,10 @@ namespace TSC {
         int Get_Waypoint_Num(const std::string& world_name);
 
         /* Check if the rect collides with a Waypoint
+         * ignore_num : skip the Waypoint with this array number
          * if no collision found returns -1
         */
-        int Get_Waypoint_Collision(const GL_rect& rect_2);
+        int Get_Waypoint_Collision(const GL_rect& rect_2, int ignore_num = -1);
         // returns the last accessible Waypoint
         int Get_Last_Valid_Waypoint(void);
         // update the Waypoint text
@@ -168,6 +169,10 @@ namespace TSC {
         bool Goto_Next_Level(std::string taken_exit = "");
         // Resets the Waypoint access to the default
         void Reset_Waypoints(void);
+        /* Mark the Waypoint indexes as outdated
+         * needs to be called if Waypoints are added, moved or renamed
+        */
+        void Invalidate_Waypoint_Index(void);
 
         // Return true if a world is loaded
         bool Is_Loaded(void) const;
@@ -213,6 +218,21 @@ namespace TSC {
         // Common stuff for constructors
         void Init();
 
+        /* Return true if the Waypoint indexes can be used
+         * rebuilds them if outdated
+         * while editing Waypoints can change at any time and the linear search is used
+        */
+        bool Update_Waypoint_Index(void);
+
+        // if the Waypoint indexes need to be rebuilt
+        bool m_waypoint_index_dirty;
+        // Waypoint array numbers by their rect
+        cSpatial_Hash<unsigned int> m_waypoint_rect_index;
+        // first Waypoint array number by destination
+        std::unordered_map<std::string, unsigned int> m_waypoint_destination_index;
+        // reused index query result
+        vector<unsigned int> m_waypoint_candidates;
+
         // Save only the main overworld file, not layers and description files.
         void Save_To_File(boost::filesystem::path path);
     };
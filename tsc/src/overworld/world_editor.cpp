@@ -55,6 +55,12 @@ void cEditor_World::Disable(void)
 
     cEditor::Disable();
     editor_world_enabled = false;
+
+    // objects may have been moved, renamed or deleted
+    if (mp_overworld) {
+        mp_overworld->m_layer->Invalidate_Index();
+        mp_overworld->Invalidate_Waypoint_Index();
+    }
 }
 
 void cEditor_World::Set_World(cOverworld* p_world)
@@ -320,6 +320,7 @@ cLine_collision::cLine_collision(void)
 cLayer::cLayer(cOverworld* origin)
 {
     m_overworld = origin;
+    m_index_dirty = 1;
 }
 
 cLayer::~cLayer(void)
@@ -340,6 +341,7 @@ void cLayer::Add(cLayer_Line_Point_Start* line_point)
     }
 
     cObject_Manager<cLayer_Line_Point_Start>::Add(line_point);
+    Invalidate_Index();
 
     // check if in sprite manager
     if (m_overworld->m_sprite_manager->Get_Array_Num(line_point) == -1) {
@@ -353,8 +355,30 @@ void cLayer::Add(cLayer_Line_Point_Start* line_point)
     }
 }
 
+bool cLayer::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    Invalidate_Index();
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(array_num, delete_data);
+}
+
+bool cLayer::Delete(cLayer_Line_Point_Start* line_point, bool delete_data /* = 1 */)
+{
+    Invalidate_Index();
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(line_point, delete_data);
+}
+
 cLayer_Line_Point_Start* cLayer::Get_Line_Start_By_UID(int uid)
 {
+    if (Update_Index()) {
+        std::unordered_map<int, unsigned int>::const_iterator itr = m_uid_index.find(uid);
+
+        if (itr == m_uid_index.end()) {
+            return NULL;
+        }
+
+        return objects[itr->second];
+    }
+
     for(LayerLineList::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         cLayer_Line_Point_Start* layer_line = (*itr);
 
@@ -399,10 +423,65 @@ void cLayer::Delete_All(void)
 {
     // only clear array
     objects.clear();
+    Invalidate_Index();
+}
+
+void cLayer::Invalidate_Index(void)
+{
+    m_index_dirty = 1;
+}
+
+bool cLayer::Update_Index(void) const
+{
+    // lines are moved without notice in the editor
+    if (editor_world_enabled) {
+        m_index_dirty = 1;
+        return 0;
+    }
+
+    if (!m_index_dirty) {
+        return 1;
+    }
+
+    m_start_point_index.Clear();
+    m_line_index.Clear();
+    m_uid_index.clear();
+
+    for (unsigned int i = 0; i < objects.size(); i++) {
+        const cLayer_Line_Point_Start* layer_line = objects[i];
+        const GL_line line = layer_line->Get_Line();
+
+        m_start_point_index.Insert(layer_line->m_col_rect, i);
+        // add a small border as the line intersection is not exact
+        m_line_index.Insert(GL_rect(std::min(line.m_x1, line.m_x2) - 1, std::min(line.m_y1, line.m_y2) - 1, fabs(line.m_x2 - line.m_x1) + 2, fabs(line.m_y2 - line.m_y1) + 2), i);
+
+        // the first line wins as with the linear search
+        m_uid_index.insert(std::make_pair(layer_line->m_uid, i));
+        m_uid_index.insert(std::make_pair(layer_line->m_linked_point->m_uid, i));
+    }
+
+    m_index_dirty = 0;
+    return 1;
 }
 
 cLayer_Line_Point_Start* cLayer::Get_Line_Collision_Start(const GL_rect& line_rect)
 {
+    if (Update_Index()) {
+        m_index_candidates.clear();
+        m_start_point_index.Query(line_rect, m_index_candidates);
+
+        // candidates are sorted by array number
+        for (vector<unsigned int>::const_iterator itr = m_index_candidates.begin(); itr != m_index_candidates.end(); ++itr) {
+            cLayer_Line_Point_Start* layer_line = objects[*itr];
+
+            if (line_rect.Intersects(layer_line->m_col_rect)) {
+                return layer_line;
+            }
+        }
+
+        return NULL;
+    }
+
     for (LayerLineList::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get pointer
         cLayer_Line_Point_Start* layer_line = (*itr);
@@ -444,16 +523,51 @@ cLine_collision cLayer::Get_Line_Collision_Direction(float x, float y, ObjectDir
 
 cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15 */, int only_origin_id /* = -1 */) const
 {
-    for (LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    if (Update_Index()) {
+        // area covered by both direction checking lines
+        GL_rect check_rect;
+
+        if (dir == DIR_HORIZONTAL) {
+            check_rect = GL_rect(x - check_size, y, check_size * 2.0f, 0);
+        }
+        else { // vertical
+            check_rect = GL_rect(x, y - check_size, 0, check_size * 2.0f);
+        }
+
+        m_index_candidates.clear();
+        m_line_index.Query(check_rect, m_index_candidates);
+
+        // candidates are sorted by array number so the first found line is the same as with the linear search
+        for (vector<unsigned int>::const_iterator itr = m_index_candidates.begin(); itr != m_index_candidates.end(); ++itr) {
+            cLayer_Line_Point_Start* layer_line = objects[*itr];
+
+            // line is not from waypoint
+            if (only_origin_id >= 0 && only_origin_id != static_cast<int>(layer_line->m_origin)) {
+                continue;
+            }
+
+            cLine_collision col = Check_Nearest_Line(layer_line, *itr, x, y, dir, check_size);
+
+            // found
+            if (col.m_line) {
+                return col;
+            }
+        }
+
+        // none found
+        return cLine_collision();
+    }
+
+    for (unsigned int i = 0; i < objects.size(); i++) {
         // get pointer
-        cLayer_Line_Point_Start* layer_line = (*itr);
+        cLayer_Line_Point_Start* layer_line = objects[i];
 
         // line is not from waypoint
-        if (only_origin_id >= 0 && only_origin_id != layer_line->m_origin) {
+        if (only_origin_id >= 0 && only_origin_id != static_cast<int>(layer_line->m_origin)) {
             continue;
         }
 
-        cLine_collision col = Get_Nearest_Line(layer_line, x, y, dir, check_size);
+        cLine_collision col = Check_Nearest_Line(layer_line, i, x, y, dir, check_size);
 
         // found
         if (col.m_line) {
@@ -466,6 +580,11 @@ cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = D
 }
 
 cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15  */) const
+{
+    return Check_Nearest_Line(map_layer_line, Get_Array_Num(map_layer_line), x, y, dir, check_size);
+}
+
+cLine_collision cLayer::Check_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size) const
 {
     GL_line line_1, line_2;
 
@@ -514,7 +633,7 @@ cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line
             cLine_collision col = cLine_collision();
 
             col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
+            col.m_line_number = line_number;
             col.m_difference = csize;
 
             // found
@@ -526,7 +645,7 @@ cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line
             cLine_collision col = cLine_collision();
 
             col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
+            col.m_line_number = line_number;
             col.m_difference = -csize;
 
             // found
@@ -21,6 +21,7 @@
 #include "../objects/movingsprite.hpp"
 #include "../core/obj_manager.hpp"
 #include "../overworld/world_waypoint.hpp"
+#include "../core/spatial_hash.hpp"
 
 namespace TSC {
 
@@ -133,6 +134,9 @@ namespace TSC {
 
         // Add a layer line
         virtual void Add(cLayer_Line_Point_Start* line_point);
+        // Remove a layer line
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        virtual bool Delete(cLayer_Line_Point_Start* line_point, bool delete_data = 1);
 
         // Save to file, raises xmlpp::exception on failure
         void Save_To_File(const boost::filesystem::path& filename);
@@ -140,6 +144,11 @@ namespace TSC {
         // Delete all objects
         virtual void Delete_All(void);
 
+        /* Mark the line indexes as outdated
+         * needs to be called if a line point got moved
+        */
+        void Invalidate_Index(void);
+
         /* Returns the colliding Line start point
          * if not found returns NULL
         */
@@ -163,6 +172,27 @@ namespace TSC {
 
         // parent overworld
         cOverworld* m_overworld;
+
+    private:
+        // Return the collision data between the given line with the given array number and position
+        cLine_collision Check_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size) const;
+
+        /* Return true if the line indexes can be used
+         * rebuilds them if outdated
+         * while editing lines can move at any time and the linear search is used
+        */
+        bool Update_Index(void) const;
+
+        // if the indexes need to be rebuilt
+        mutable bool m_index_dirty;
+        // line array numbers by the collision rect of their start point
+        mutable cSpatial_Hash<unsigned int> m_start_point_index;
+        // line array numbers by the bounding rect of the line
+        mutable cSpatial_Hash<unsigned int> m_line_index;
+        // line array number by the UID of its start and end point
+        mutable std::unordered_map<int, unsigned int> m_uid_index;
+        // reused index query result
+        mutable vector<unsigned int> m_index_candidates;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
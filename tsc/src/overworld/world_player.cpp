@@ -19,6 +19,7 @@
 #include "../core/framerate.hpp"
 #include "../overworld/overworld.hpp"
 #include "../level/level.hpp"
+#include "../level/level_manager.hpp"
 #include "../audio/audio.hpp"
 #include "../gui/menu.hpp"
 #include "../video/renderer.hpp"
@@ -337,6 +338,29 @@ void cOverworld_Player::Update_Vel(void)
     }
 }
 
+void cOverworld_Player::Update_Level_Prefetch(void)
+{
+    // entering the level or something else
+    if (Game_Action != GA_NONE) {
+        return;
+    }
+
+    // walking
+    if (m_current_waypoint < 0 || m_direction != DIR_UNDEFINED) {
+        pLevel_Manager->Cancel_Prefetch();
+        return;
+    }
+
+    cWaypoint* waypoint = Get_Waypoint();
+
+    if (!waypoint || waypoint->m_waypoint_type != WAYPOINT_NORMAL) {
+        pLevel_Manager->Cancel_Prefetch();
+        return;
+    }
+
+    pLevel_Manager->Prefetch(waypoint->Get_Destination());
+}
+
 bool cOverworld_Player::Start_Walk(ObjectDirection new_direction)
 {
     // already walking into the given direction
@@ -489,17 +513,11 @@ void cOverworld_Player::Update_Walk(void)
 
     Auto_Pos_Correction();
 
-    // check if a new waypoint is near alex
-    for (unsigned int i = 0; i < m_overworld->m_waypoints.size(); i++) {
-        // skip the start waypoint
-        if (static_cast<int>(i) == m_current_waypoint) {
-            continue;
-        }
+    // check if a new waypoint is near alex, skipping the start waypoint
+    int new_waypoint = m_overworld->Get_Waypoint_Collision(m_col_rect, m_current_waypoint);
 
-        if (m_overworld->m_waypoints[i]->m_rect.Intersects(m_col_rect)) {
-            Start_Waypoint_Walk(i);
-            break;
-        }
+    if (new_waypoint >= 0) {
+        Start_Waypoint_Walk(new_waypoint);
     }
 }
 
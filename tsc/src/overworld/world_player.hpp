@@ -67,6 +67,10 @@ namespace TSC {
 
         // Activates the current Waypoint
         void Activate_Waypoint(void);
+        /* Load the level of the current Waypoint in the background
+         * while standing on it and throw it away when walking on
+        */
+        void Update_Level_Prefetch(void);
 
         /* Start walking into the given direction
          * returns 0 if the next level is not accessible or not available
@@ -43,7 +43,10 @@ void cEvent::Fire(cMRuby_Interpreter* p_mruby, Scripting::cScriptable_Object* p_
 
     std::vector<mrb_value>::iterator iter;
     for (iter=start; iter != end; iter++) {
+        const size_t depth = p_mruby->Get_Profiler().Begin(*iter, evtname);
         Run_MRuby_Callback(p_mruby, *iter);
+        p_mruby->Get_Profiler().End(depth);
+
         if (p_state->exc) {
             cerr << "Warning: Error running mruby handler:" << endl;
             mrb_print_error(p_state);
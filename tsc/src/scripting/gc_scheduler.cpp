@@ -0,0 +1,179 @@
+/***************************************************************************
+ * gc_scheduler.cpp - Running the mruby garbage collection in idle time
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gc_scheduler.hpp"
+#include "../core/game_core.hpp"
+#include "../core/framerate.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+namespace Scripting {
+
+cGC_Scheduler::cGC_Scheduler(mrb_state* p_state)
+{
+    mp_mruby = p_state;
+    m_active = 0;
+    m_live_limit = 0;
+    m_last_step_us = 0;
+
+    m_statistics.m_steps = 0;
+    m_statistics.m_step_us_max = 0;
+    m_statistics.m_cycles = 0;
+    m_statistics.m_forced_frames = 0;
+    m_statistics.m_full_collections = 0;
+    m_statistics.m_full_us_max = 0;
+    m_statistics.m_total_us = 0;
+    m_statistics.m_last_frame_us = 0;
+}
+
+cGC_Scheduler::~cGC_Scheduler()
+{
+    //
+}
+
+void cGC_Scheduler::Set_Active(bool active)
+{
+    if (m_active == active)
+        return;
+
+    if (active) {
+        // Keep a pending exception of the caller
+        struct RObject* p_exc = mp_mruby->exc;
+        mp_mruby->exc = NULL;
+
+        // A generational minor collection always runs until it is
+        // finished, only the incremental mode can be split into steps.
+        mrb_funcall(mp_mruby, mrb_obj_value(mrb_module_get(mp_mruby, "GC")), "generational_mode=", 1, mrb_false_value());
+
+        // fails if a script disabled the GC
+        const bool failed = mp_mruby->exc != NULL;
+        mp_mruby->exc = p_exc;
+
+        if (failed) {
+            cerr << "Warning: Could not switch the mruby GC to incremental mode, it keeps collecting on its own" << endl;
+            return;
+        }
+
+        m_active = 1;
+        mp_mruby->gc.disabled = TRUE;
+        Update_Live_Limit();
+    }
+    else {
+        m_active = 0;
+        mp_mruby->gc.disabled = FALSE;
+    }
+}
+
+bool cGC_Scheduler::Is_Active() const
+{
+    return m_active;
+}
+
+void cGC_Scheduler::Update(uint64_t time_left)
+{
+    if (!m_active)
+        return;
+
+    m_statistics.m_last_frame_us = 0;
+
+    // start a cycle when mruby would have started one
+    if (mp_mruby->gc.state == MRB_GC_STATE_ROOT && mp_mruby->gc.live <= mp_mruby->gc.threshold) {
+        pFramerate->m_perf_timer[PERF_UPDATE_SCRIPT_GC]->Add(0);
+        return;
+    }
+
+    // the scripts allocate faster than the idle time collects
+    const bool forced = mp_mruby->gc.live > m_live_limit;
+
+    if (forced)
+        m_statistics.m_forced_frames++;
+
+    const uint64_t start = TSC_GetMicroTicks();
+    mp_mruby->gc.disabled = FALSE;
+
+    while (true) {
+        const uint64_t step_start = TSC_GetMicroTicks();
+        mrb_incremental_gc(mp_mruby);
+        m_last_step_us = TSC_GetMicroTicks() - step_start;
+
+        m_statistics.m_steps++;
+
+        if (m_last_step_us > m_statistics.m_step_us_max)
+            m_statistics.m_step_us_max = m_last_step_us;
+
+        if (mp_mruby->gc.state == MRB_GC_STATE_ROOT) {
+            m_statistics.m_cycles++;
+            Update_Live_Limit();
+            break;
+        }
+
+        // stop if the next step would not fit
+        if (!forced && TSC_GetMicroTicks() - start + m_last_step_us > time_left)
+            break;
+    }
+
+    mp_mruby->gc.disabled = TRUE;
+
+    m_statistics.m_last_frame_us = TSC_GetMicroTicks() - start;
+    m_statistics.m_total_us += m_statistics.m_last_frame_us;
+    pFramerate->m_perf_timer[PERF_UPDATE_SCRIPT_GC]->Add(m_statistics.m_last_frame_us);
+}
+
+void cGC_Scheduler::Full_Collect()
+{
+    const uint64_t start = TSC_GetMicroTicks();
+
+    // mrb_full_gc() does nothing while disabled
+    mp_mruby->gc.disabled = FALSE;
+    mrb_full_gc(mp_mruby);
+    mp_mruby->gc.disabled = m_active;
+
+    const uint64_t full_us = TSC_GetMicroTicks() - start;
+
+    m_statistics.m_full_collections++;
+    m_statistics.m_total_us += full_us;
+
+    if (full_us > m_statistics.m_full_us_max)
+        m_statistics.m_full_us_max = full_us;
+
+    Update_Live_Limit();
+}
+
+const cGC_Statistics& cGC_Scheduler::Get_Statistics() const
+{
+    return m_statistics;
+}
+
+void cGC_Scheduler::Print_Statistics() const
+{
+    debug_print("Scripting engine: GC %u steps (max %.2f ms), %u cycles, %u forced frames, %u full collections (max %.2f ms), total %.2f ms\n",
+                m_statistics.m_steps,
+                m_statistics.m_step_us_max / 1000.0f,
+                m_statistics.m_cycles,
+                m_statistics.m_forced_frames,
+                m_statistics.m_full_collections,
+                m_statistics.m_full_us_max / 1000.0f,
+                m_statistics.m_total_us / 1000.0f);
+}
+
+void cGC_Scheduler::Update_Live_Limit()
+{
+    // twice the amount mruby would start a collection at
+    m_live_limit = mp_mruby->gc.threshold * 2;
+}
+
+}
+}
@@ -0,0 +1,91 @@
+/***************************************************************************
+ * gc_scheduler.hpp - Running the mruby garbage collection in idle time
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TSC_SCRIPTING_GC_SCHEDULER_HPP
+#define TSC_SCRIPTING_GC_SCHEDULER_HPP
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+    namespace Scripting {
+
+        /**
+         * Pauses caused by the garbage collection.
+         */
+        struct cGC_Statistics {
+            // incremental steps run by Update()
+            uint32_t m_steps;
+            uint64_t m_step_us_max;
+            // finished incremental collection cycles
+            uint32_t m_cycles;
+            // frames which had to finish a cycle without time limit
+            uint32_t m_forced_frames;
+            // collections at safe points
+            uint32_t m_full_collections;
+            uint64_t m_full_us_max;
+            // microseconds of all steps and full collections
+            uint64_t m_total_us;
+            // microseconds in the last Update()
+            uint64_t m_last_frame_us;
+        };
+
+        /**
+         * mruby starts a garbage collection whenever an allocation
+         * crosses the threshold, which lets the pauses land in any
+         * frame. Once activated, the automatic collection is disabled
+         * and the scheduler runs incremental steps in the time the
+         * frame has left. Full collections only run when requested
+         * at a safe point, e.g. while the screen is faded out.
+         *
+         * If the scripts allocate faster than the idle time can
+         * collect, the running cycle is finished without time limit
+         * so the memory does not grow without bounds.
+         */
+        class cGC_Scheduler {
+        public:
+            cGC_Scheduler(mrb_state* p_state);
+            ~cGC_Scheduler();
+
+            // Take over the collection from mruby (true) or give
+            // it back (false). Stays inactive if the incremental
+            // mode can not be enabled.
+            void Set_Active(bool active);
+            bool Is_Active() const;
+
+            // Run incremental steps for at most `time_left'
+            // microseconds. At least one step runs if a cycle
+            // is in progress. Does nothing if not active.
+            void Update(uint64_t time_left);
+            // Collect all garbage now.
+            void Full_Collect();
+
+            const cGC_Statistics& Get_Statistics() const;
+            // Print the statistics as debug output.
+            void Print_Statistics() const;
+
+        private:
+            // Set the live object count which forces a collection.
+            void Update_Live_Limit();
+
+            mrb_state* mp_mruby;
+            bool m_active;
+            // live objects above which a cycle is forced
+            size_t m_live_limit;
+            // duration of the last step to predict the next one
+            uint64_t m_last_step_us;
+            cGC_Statistics m_statistics;
+        };
+    };
+};
+
+#endif
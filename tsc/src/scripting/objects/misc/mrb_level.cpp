@@ -17,8 +17,11 @@
 #include "../../../user/savegame/savegame.hpp"
 #include "../../../gui/hud.hpp"
 #include "../../../core/property_helper.hpp"
+#include "../../../core/sprite_manager.hpp"
+#include "../../../core/math/circle.hpp"
 #include "../../events/event.hpp"
 #include "../mrb_eventable.hpp"
+#include "../mrb_uids.hpp"
 #include "mrb_level.hpp"
 
 /**
@@ -532,6 +535,325 @@ static mrb_value Get_Fixed_Hor_Vel(mrb_state* p_state, mrb_value self)
     return mrb_float_value(p_state, pActive_Level->m_fixed_camera_hor_vel);
 }
 
+/********************* Sprite queries ********************/
+
+// Sprite types and collision arrays the queries can be limited to.
+// Several entries may share a name (e.g. all boxes).
+static const struct {
+    const char* name;
+    SpriteType type;
+    ArrayType sprite_array;
+} query_types[] = {
+    // collision arrays
+    {"massive", TYPE_UNDEFINED, ARRAY_MASSIVE},
+    {"passive", TYPE_UNDEFINED, ARRAY_PASSIVE},
+    {"enemy", TYPE_UNDEFINED, ARRAY_ENEMY},
+    {"active", TYPE_UNDEFINED, ARRAY_ACTIVE},
+    // enemies
+    {"armadillo", TYPE_ARMY, ARRAY_UNDEFINED},
+    {"beetle", TYPE_BEETLE, ARRAY_UNDEFINED},
+    {"beetle_barrage", TYPE_BEETLE_BARRAGE, ARRAY_UNDEFINED},
+    {"doom_larry", TYPE_DOOM_LARRY, ARRAY_UNDEFINED},
+    {"eato", TYPE_EATO, ARRAY_UNDEFINED},
+    {"flyon", TYPE_FLYON, ARRAY_UNDEFINED},
+    {"furball", TYPE_FURBALL, ARRAY_UNDEFINED},
+    {"furball", TYPE_FURBALL_BOSS, ARRAY_UNDEFINED},
+    {"gee", TYPE_GEE, ARRAY_UNDEFINED},
+    {"krush", TYPE_KRUSH, ARRAY_UNDEFINED},
+    {"larry", TYPE_LARRY, ARRAY_UNDEFINED},
+    {"pip", TYPE_PIP, ARRAY_UNDEFINED},
+    {"rokko", TYPE_ROKKO, ARRAY_UNDEFINED},
+    {"shell", TYPE_SHELL, ARRAY_UNDEFINED},
+    {"spika", TYPE_SPIKA, ARRAY_UNDEFINED},
+    {"spikeball", TYPE_SPIKEBALL, ARRAY_UNDEFINED},
+    {"static", TYPE_STATIC_ENEMY, ARRAY_UNDEFINED},
+    {"thromp", TYPE_THROMP, ARRAY_UNDEFINED},
+    {"turtle_boss", TYPE_TURTLE_BOSS, ARRAY_UNDEFINED},
+    // boxes
+    {"box", TYPE_BONUS_BOX, ARRAY_UNDEFINED},
+    {"box", TYPE_SPIN_BOX, ARRAY_UNDEFINED},
+    {"box", TYPE_TEXT_BOX, ARRAY_UNDEFINED},
+    {"bonus_box", TYPE_BONUS_BOX, ARRAY_UNDEFINED},
+    {"spin_box", TYPE_SPIN_BOX, ARRAY_UNDEFINED},
+    {"text_box", TYPE_TEXT_BOX, ARRAY_UNDEFINED},
+    // items
+    {"jewel", TYPE_GOLDPIECE, ARRAY_UNDEFINED},
+    {"jewel", TYPE_JUMPING_GOLDPIECE, ARRAY_UNDEFINED},
+    {"jewel", TYPE_FALLING_GOLDPIECE, ARRAY_UNDEFINED},
+    {"berry", TYPE_MUSHROOM_DEFAULT, ARRAY_UNDEFINED},
+    {"berry", TYPE_MUSHROOM_LIVE_1, ARRAY_UNDEFINED},
+    {"berry", TYPE_MUSHROOM_POISON, ARRAY_UNDEFINED},
+    {"berry", TYPE_MUSHROOM_BLUE, ARRAY_UNDEFINED},
+    {"berry", TYPE_MUSHROOM_GHOST, ARRAY_UNDEFINED},
+    {"fireplant", TYPE_FIREPLANT, ARRAY_UNDEFINED},
+    {"star", TYPE_STAR, ARRAY_UNDEFINED},
+    {"moon", TYPE_MOON, ARRAY_UNDEFINED},
+    // specials
+    {"ball", TYPE_BALL, ARRAY_UNDEFINED},
+    {"crate", TYPE_CRATE, ARRAY_UNDEFINED},
+    {"enemy_stopper", TYPE_ENEMY_STOPPER, ARRAY_UNDEFINED},
+    {"level_entry", TYPE_LEVEL_ENTRY, ARRAY_UNDEFINED},
+    {"level_exit", TYPE_LEVEL_EXIT, ARRAY_UNDEFINED},
+    {"moving_platform", TYPE_MOVING_PLATFORM, ARRAY_UNDEFINED},
+    {"particle_emitter", TYPE_PARTICLE_EMITTER, ARRAY_UNDEFINED},
+    {"path", TYPE_PATH, ARRAY_UNDEFINED},
+    {"secret_area", TYPE_SECRET_AREA, ARRAY_UNDEFINED},
+    {"sound", TYPE_SOUND, ARRAY_UNDEFINED}
+};
+
+// Add the sprites of the given type symbol from the sprite
+// manager's type and array buckets to `candidates'.
+static void Add_Query_Candidates(mrb_state* p_state, mrb_sym type, cSprite_List& candidates)
+{
+    std::string typestr(mrb_sym2name(p_state, type));
+    bool found = false;
+
+    for (unsigned int i = 0; i < sizeof(query_types) / sizeof(query_types[0]); i++) {
+        if (typestr != query_types[i].name)
+            continue;
+
+        const cSprite_List& bucket = query_types[i].type != TYPE_UNDEFINED
+                                     ? pActive_Level->m_sprite_manager->Get_Objects_by_Type(query_types[i].type)
+                                     : pActive_Level->m_sprite_manager->Get_Objects_by_Array(query_types[i].sprite_array);
+
+        candidates.insert(candidates.end(), bucket.begin(), bucket.end());
+        found = true;
+    }
+
+    if (!found)
+        mrb_raisef(p_state, MRB_ARGUMENT_ERROR(p_state), "Invalid sprite type %s", typestr.c_str());
+}
+
+// Return the not destroyed sprites from `sprites' as an MRuby
+// array sorted by UID. The objects are the ones UIDS[] returns.
+static mrb_value Create_Query_Result(mrb_state* p_state, cSprite_List& sprites)
+{
+    // the buckets are not ordered
+    std::sort(sprites.begin(), sprites.end(), [](const cSprite* a, const cSprite* b) {
+        return a->m_uid < b->m_uid;
+    });
+    sprites.erase(std::unique(sprites.begin(), sprites.end()), sprites.end());
+
+    mrb_value result = mrb_ary_new_capa(p_state, sprites.size());
+    int arena = mrb_gc_arena_save(p_state);
+
+    for (cSprite_List::const_iterator iter = sprites.begin(); iter != sprites.end(); iter++) {
+        if ((*iter)->m_auto_destroy)
+            continue;
+
+        mrb_value obj = Get_Sprite_Object(p_state, *iter);
+
+        if (!mrb_nil_p(obj))
+            mrb_ary_push(p_state, result, obj);
+
+        // the objects are kept by the result and the UIDS cache
+        mrb_gc_arena_restore(p_state, arena);
+    }
+
+    return result;
+}
+
+/**
+ * Method: LevelClass#sprites_of_type
+ *
+ *   sprites_of_type( *types ) → an_array
+ *
+ * Returns all sprites of the given types in the level, sorted by
+ * their UIDs. The player is not included, use L<Player> instead.
+ *
+ * =head4 Parameters
+ *
+ * =over
+ *
+ * =item [types]
+ *
+ * One or more of the following symbols. The first four select the
+ * sprites by how they collide, the others by what they are.
+ *
+ * :massive, :passive, :enemy, :active, :armadillo, :beetle,
+ * :beetle_barrage, :doom_larry, :eato, :flyon, :furball, :gee,
+ * :krush, :larry, :pip, :rokko, :shell, :spika, :spikeball,
+ * :static, :thromp, :turtle_boss, :box, :bonus_box, :spin_box,
+ * :text_box, :jewel, :berry, :fireplant, :star, :moon, :ball,
+ * :crate, :enemy_stopper, :level_entry, :level_exit,
+ * :moving_platform, :particle_emitter, :path, :secret_area, :sound
+ *
+ * =back
+ *
+ * =head4 Return value
+ *
+ * An array with instances of C<Sprite> and its subclasses. These are
+ * the same objects L<UIDS> returns.
+ *
+ * =head4 Cost
+ *
+ * The level keeps a list of sprites for every type, so the cost only
+ * depends on the number of matching sprites and not on the size of
+ * the level. Sprites which were never requested from MRuby before get
+ * an MRuby object created once, just like with C<UIDS::[]>. Calling
+ * this method once is much cheaper than looping over C<UIDS> ranges.
+ *
+ * =head4 Example
+ *
+ *     # Kill all enemies of the level
+ *     Level.sprites_of_type(:enemy).each { |enemy| enemy.kill! }
+ */
+static mrb_value Sprites_Of_Type(mrb_state* p_state, mrb_value self)
+{
+    mrb_value* args = NULL;
+    int count = 0;
+    mrb_get_args(p_state, "*", &args, &count);
+
+    cSprite_List candidates;
+
+    for (int i = 0; i < count; i++) {
+        if (!mrb_symbol_p(args[i])) {
+            mrb_raise(p_state, MRB_TYPE_ERROR(p_state), "Sprite type must be a symbol.");
+            return mrb_nil_value(); // Not reached
+        }
+
+        Add_Query_Candidates(p_state, mrb_symbol(args[i]), candidates);
+    }
+
+    return Create_Query_Result(p_state, candidates);
+}
+
+/**
+ * Method: LevelClass#sprites_in_rect
+ *
+ *   sprites_in_rect( x, y, width, height [, type ] ) → an_array
+ *
+ * Returns all sprites whose collision rectangle touches the given
+ * rectangle, sorted by their UIDs. The player is not included.
+ *
+ * =head4 Parameters
+ *
+ * =over
+ *
+ * =item [x]
+ *
+ * X coordinate of the rectangle’s upper left corner.
+ *
+ * =item [y]
+ *
+ * Y coordinate of the rectangle’s upper left corner.
+ *
+ * =item [width]
+ *
+ * Width of the rectangle.
+ *
+ * =item [height]
+ *
+ * Height of the rectangle.
+ *
+ * =item [type]
+ *
+ * Only return sprites of this type. See L<#sprites_of_type> for the
+ * possible symbols.
+ *
+ * =back
+ *
+ * =head4 Cost
+ *
+ * Without C<type> every sprite of the level is checked, with C<type>
+ * only the sprites of that type. The check runs in C++ and is fast,
+ * but in a large level you should still pass a C<type> if you call
+ * this every frame. Prefer this method over computing the distances
+ * of many sprites in MRuby.
+ *
+ * =head4 Example
+ *
+ *     # All boxes in front of the level's start
+ *     Level.sprites_in_rect(0, -600, 800, 600, :box)
+ */
+static mrb_value Sprites_In_Rect(mrb_state* p_state, mrb_value self)
+{
+    mrb_float x, y, width, height;
+    mrb_sym type = 0;
+    mrb_get_args(p_state, "ffff|n", &x, &y, &width, &height, &type);
+
+    cSprite_List candidates;
+
+    if (type)
+        Add_Query_Candidates(p_state, type, candidates);
+    else
+        candidates = pActive_Level->m_sprite_manager->objects;
+
+    GL_rect rect(x, y, width, height);
+    cSprite_List sprites;
+
+    for (cSprite_List::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++) {
+        if (rect.Intersects((*iter)->m_col_rect))
+            sprites.push_back(*iter);
+    }
+
+    return Create_Query_Result(p_state, sprites);
+}
+
+/**
+ * Method: LevelClass#sprites_in_circle
+ *
+ *   sprites_in_circle( x, y, radius [, type ] ) → an_array
+ *
+ * Returns all sprites whose collision rectangle touches the given
+ * circle, sorted by their UIDs. The player is not included.
+ *
+ * =head4 Parameters
+ *
+ * =over
+ *
+ * =item [x]
+ *
+ * X coordinate of the circle’s center.
+ *
+ * =item [y]
+ *
+ * Y coordinate of the circle’s center.
+ *
+ * =item [radius]
+ *
+ * Radius of the circle.
+ *
+ * =item [type]
+ *
+ * Only return sprites of this type. See L<#sprites_of_type> for the
+ * possible symbols.
+ *
+ * =back
+ *
+ * =head4 Cost
+ *
+ * The same as for L<#sprites_in_rect>.
+ *
+ * =head4 Example
+ *
+ *     # Enemies near Alex
+ *     Level.sprites_in_circle(Player.x, Player.y, 300, :enemy)
+ */
+static mrb_value Sprites_In_Circle(mrb_state* p_state, mrb_value self)
+{
+    mrb_float x, y, radius;
+    mrb_sym type = 0;
+    mrb_get_args(p_state, "fff|n", &x, &y, &radius, &type);
+
+    cSprite_List candidates;
+
+    if (type)
+        Add_Query_Candidates(p_state, type, candidates);
+    else
+        candidates = pActive_Level->m_sprite_manager->objects;
+
+    GL_Circle circle(x, y, radius);
+    cSprite_List sprites;
+
+    for (cSprite_List::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++) {
+        if (circle.Intersects((*iter)->m_col_rect))
+            sprites.push_back(*iter);
+    }
+
+    return Create_Query_Result(p_state, sprites);
+}
+
 /********************* StackEntry ********************/
 
 /**
@@ -807,6 +1129,9 @@ void TSC::Scripting::Init_Level(mrb_state* p_state)
     mrb_define_method(p_state, p_rcLevel, "boundaries", Get_Boundaries, MRB_ARGS_NONE());
     mrb_define_method(p_state, p_rcLevel, "start_position", Get_Start_Position, MRB_ARGS_NONE());
     mrb_define_method(p_state, p_rcLevel, "fixed_horizontal_velocity", Get_Fixed_Hor_Vel, MRB_ARGS_NONE());
+    mrb_define_method(p_state, p_rcLevel, "sprites_of_type", Sprites_Of_Type, MRB_ARGS_ANY());
+    mrb_define_method(p_state, p_rcLevel, "sprites_in_rect", Sprites_In_Rect, MRB_ARGS_REQ(4) | MRB_ARGS_OPT(1));
+    mrb_define_method(p_state, p_rcLevel, "sprites_in_circle", Sprites_In_Circle, MRB_ARGS_REQ(3) | MRB_ARGS_OPT(1));
 
     mrb_define_method(p_state, p_rcLevel, "on_save_load", MRUBY_EVENT_HANDLER(save_load), MRB_ARGS_NONE());
 
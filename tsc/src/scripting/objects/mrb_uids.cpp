@@ -225,6 +225,28 @@ void TSC::Scripting::Delete_UID_From_Cache(mrb_state* p_state, int uid)
     mrb_hash_delete_key(p_state, cache, mrb_fixnum_value(uid));
 }
 
+mrb_value TSC::Scripting::Get_Sprite_Object(mrb_state* p_state, cSprite* p_sprite)
+{
+    // Not managed by the level, so there is nothing to cache it under
+    if (p_sprite->m_uid < 0)
+        return p_sprite->Create_MRuby_Object(p_state);
+
+    mrb_value cache = mrb_iv_get(p_state, mrb_obj_value(mrb_class_get(p_state, "UIDS")), mrb_intern_cstr(p_state, "cache"));
+    mrb_value ruid = mrb_fixnum_value(p_sprite->m_uid);
+    mrb_value obj = mrb_hash_get(p_state, cache, ruid);
+
+    if (!mrb_nil_p(obj))
+        return obj;
+
+    // Same object as UIDS[] returns later, which matters for events
+    obj = p_sprite->Create_MRuby_Object(p_state);
+
+    if (!mrb_nil_p(obj))
+        mrb_hash_set(p_state, cache, ruid, obj);
+
+    return obj;
+}
+
 void TSC::Scripting::Init_UIDS(mrb_state* p_state)
 {
     struct RClass* p_rmUIDS = mrb_define_module(p_state, "UIDS");
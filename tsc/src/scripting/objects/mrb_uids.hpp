@@ -17,9 +17,14 @@
 #include "../scripting.hpp"
 
 namespace TSC {
+    class cSprite;
+
     namespace Scripting {
         void Init_UIDS(mrb_state* p_state);
         void Delete_UID_From_Cache(mrb_state* p_state, int uid);
+        // Return the cached MRuby object for the sprite, creating
+        // and caching it if it was not requested before.
+        mrb_value Get_Sprite_Object(mrb_state* p_state, cSprite* p_sprite);
     }
 }
 
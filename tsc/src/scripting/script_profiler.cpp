@@ -0,0 +1,274 @@
+/***************************************************************************
+ * script_profiler.cpp - Time spent in the mruby callbacks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "script_profiler.hpp"
+#include "../core/game_core.hpp"
+#include "../core/framerate.hpp"
+#include "../core/property_helper.hpp"
+#include "../user/preferences.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+namespace Scripting {
+
+cScript_Profiler::cScript_Profiler(mrb_state* p_state)
+{
+    mp_mruby = p_state;
+    m_last_warning_ticks = 0;
+    Reset();
+}
+
+cScript_Profiler::~cScript_Profiler()
+{
+    Clear_Irep_Locations();
+}
+
+size_t cScript_Profiler::Begin(mrb_value callback, const std::string& fallback)
+{
+    std::string location = Get_Location(callback);
+
+    if (location.empty())
+        location = fallback;
+
+    return Begin_Entry(Get_Entry(location));
+}
+
+size_t cScript_Profiler::Begin(const std::string& location)
+{
+    return Begin_Entry(Get_Entry(location));
+}
+
+size_t cScript_Profiler::Begin_Entry(size_t entry)
+{
+    const size_t depth = m_running.size();
+
+    Running_Call call;
+    call.m_entry = entry;
+    call.m_start_live = mp_mruby->gc.live;
+    call.m_nested_us = 0;
+    call.m_nested_objects = 0;
+    // last so the setup is not measured
+    call.m_start_us = TSC_GetMicroTicks();
+
+    m_running.push_back(call);
+    return depth;
+}
+
+/**
+ * A Ruby exception raised in a nested callback jumps straight to
+ * the mruby call of the outer callback, so the End() of the nested
+ * one is never reached. Its time is counted when the outer call or
+ * the frame ends.
+ */
+void cScript_Profiler::End(size_t depth)
+{
+    while (m_running.size() > depth)
+        End_Call();
+}
+
+void cScript_Profiler::End_Call()
+{
+    const uint64_t elapsed = TSC_GetMicroTicks() - m_running.back().m_start_us;
+    const Running_Call call = m_running.back();
+    m_running.pop_back();
+
+    const int64_t objects = static_cast<int64_t>(mp_mruby->gc.live) - static_cast<int64_t>(call.m_start_live);
+    const uint64_t own_us = elapsed - std::min(call.m_nested_us, elapsed);
+
+    cScript_Profile_Entry& entry = m_entries[call.m_entry];
+    entry.m_calls++;
+    entry.m_total_us += own_us;
+    entry.m_frame_us += own_us;
+    entry.m_objects += objects - call.m_nested_objects;
+
+    if (own_us > entry.m_max_us)
+        entry.m_max_us = own_us;
+
+    if (m_running.empty()) {
+        m_frame_us += elapsed;
+    }
+    else {
+        m_running.back().m_nested_us += elapsed;
+        m_running.back().m_nested_objects += objects;
+    }
+}
+
+void cScript_Profiler::End_Frame()
+{
+    End(0);
+
+    m_last_frame_us = m_frame_us;
+    m_frame_us = 0;
+    m_last_frame_slowest = -1;
+
+    uint64_t slowest_us = 0;
+
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        if (m_entries[i].m_frame_us > slowest_us) {
+            slowest_us = m_entries[i].m_frame_us;
+            m_last_frame_slowest = static_cast<int>(i);
+        }
+
+        m_entries[i].m_frame_us = 0;
+    }
+
+    pFramerate->m_perf_timer[PERF_UPDATE_SCRIPTS]->Add(m_last_frame_us);
+
+    // budget of 0 disables the warning
+    const float budget_ms = pPreferences->m_script_budget;
+
+    if (budget_ms <= 0.0f || m_last_frame_us <= static_cast<uint64_t>(budget_ms * 1000.0f))
+        return;
+
+    // warn at most once a second
+    const uint32_t ticks = TSC_GetTicks();
+
+    if (m_last_warning_ticks && ticks - m_last_warning_ticks < 1000)
+        return;
+
+    m_last_warning_ticks = ticks;
+
+    cerr << "Warning: Scripts took " << float_to_string(m_last_frame_us / 1000.0f, 2) << " ms of the "
+         << float_to_string(budget_ms, 2) << " ms frame budget";
+
+    if (m_last_frame_slowest >= 0)
+        cerr << ", most in " << m_entries[m_last_frame_slowest].m_location;
+
+    cerr << endl;
+}
+
+void cScript_Profiler::Reset()
+{
+    m_entries.clear();
+    m_entry_indices.clear();
+    m_running.clear();
+    m_frame_us = 0;
+    m_last_frame_us = 0;
+    m_last_frame_slowest = -1;
+    Clear_Irep_Locations();
+}
+
+void cScript_Profiler::Clear_Irep_Locations()
+{
+    for (const std::pair<const void* const, Irep_Location>& irep_location: m_irep_locations)
+        mrb_gc_unregister(mp_mruby, irep_location.second.m_proc);
+
+    m_irep_locations.clear();
+}
+
+uint64_t cScript_Profiler::Get_Last_Frame_Time() const
+{
+    return m_last_frame_us;
+}
+
+const cScript_Profile_Entry* cScript_Profiler::Get_Last_Frame_Slowest() const
+{
+    if (m_last_frame_slowest < 0)
+        return NULL;
+
+    return &m_entries[m_last_frame_slowest];
+}
+
+std::vector<const cScript_Profile_Entry*> cScript_Profiler::Get_Entries() const
+{
+    std::vector<const cScript_Profile_Entry*> entries;
+
+    for (const cScript_Profile_Entry& entry: m_entries)
+        entries.push_back(&entry);
+
+    std::sort(entries.begin(), entries.end(), [](const cScript_Profile_Entry* a, const cScript_Profile_Entry* b) {
+        return a->m_total_us > b->m_total_us;
+    });
+
+    return entries;
+}
+
+size_t cScript_Profiler::Get_Entry(const std::string& location)
+{
+    std::unordered_map<std::string, size_t>::const_iterator itr = m_entry_indices.find(location);
+
+    if (itr != m_entry_indices.end())
+        return itr->second;
+
+    cScript_Profile_Entry entry;
+    entry.m_location = location;
+    entry.m_calls = 0;
+    entry.m_total_us = 0;
+    entry.m_max_us = 0;
+    entry.m_frame_us = 0;
+    entry.m_objects = 0;
+
+    m_entries.push_back(entry);
+    m_entry_indices[location] = m_entries.size() - 1;
+
+    return m_entries.size() - 1;
+}
+
+/**
+ * All procs created from the same block share the compiled
+ * code, so Proc#source_location only needs to be asked once
+ * for every block. Procs defined in C and code compiled without
+ * debug information have no location. The first proc of every
+ * block is registered with the garbage collector until Reset(),
+ * otherwise a freed block could leave its location to a new
+ * block at the same address.
+ */
+std::string cScript_Profiler::Get_Location(mrb_value callback)
+{
+    if (mrb_type(callback) != MRB_TT_PROC)
+        return "";
+
+    struct RProc* p_proc = mrb_proc_ptr(callback);
+    if (MRB_PROC_CFUNC_P(p_proc))
+        return "";
+
+    const void* p_irep = p_proc->body.irep;
+    std::unordered_map<const void*, Irep_Location>::const_iterator itr = m_irep_locations.find(p_irep);
+
+    if (itr != m_irep_locations.end())
+        return itr->second.m_location;
+
+    // Keep a pending exception of the caller
+    struct RObject* p_exc = mp_mruby->exc;
+    mp_mruby->exc = NULL;
+    int arena = mrb_gc_arena_save(mp_mruby);
+
+    std::string location;
+    mrb_value rlocation = mrb_funcall(mp_mruby, callback, "source_location", 0);
+
+    if (!mp_mruby->exc && mrb_array_p(rlocation) && RARRAY_LEN(rlocation) == 2) {
+        mrb_value rfile = mrb_ary_ref(mp_mruby, rlocation, 0);
+        mrb_value rline = mrb_ary_ref(mp_mruby, rlocation, 1);
+
+        if (mrb_string_p(rfile) && mrb_fixnum_p(rline))
+            location = std::string(RSTRING_PTR(rfile), RSTRING_LEN(rfile)) + ":" + int_to_string(mrb_fixnum(rline));
+    }
+
+    mrb_gc_arena_restore(mp_mruby, arena);
+    mp_mruby->exc = p_exc;
+
+    mrb_gc_register(mp_mruby, callback);
+
+    Irep_Location irep_location;
+    irep_location.m_proc = callback;
+    irep_location.m_location = location;
+    m_irep_locations[p_irep] = irep_location;
+
+    return location;
+}
+
+}
+}
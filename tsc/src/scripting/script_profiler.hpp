@@ -0,0 +1,125 @@
+/***************************************************************************
+ * script_profiler.hpp - Time spent in the mruby callbacks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TSC_SCRIPTING_SCRIPT_PROFILER_HPP
+#define TSC_SCRIPTING_SCRIPT_PROFILER_HPP
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+    namespace Scripting {
+
+        /**
+         * Statistics of all callbacks defined at one place
+         * in the scripts.
+         */
+        struct cScript_Profile_Entry {
+            // "file:line" of the proc or the context name
+            std::string m_location;
+            uint32_t m_calls;
+            // microseconds without the time of nested callbacks
+            uint64_t m_total_us;
+            uint64_t m_max_us;
+            // microseconds in the last frame
+            uint64_t m_frame_us;
+            // change of the live mruby objects. A garbage collection
+            // run during the callback makes it smaller.
+            int64_t m_objects;
+        };
+
+        /**
+         * Measures the mruby code run by the interpreter. Every
+         * callback is framed by Begin() and End() and the time is
+         * added to the location the proc was defined at. Callbacks
+         * running other callbacks (e.g. an event fired from a timer)
+         * are only counted once for the frame total.
+         */
+        class cScript_Profiler {
+        public:
+            cScript_Profiler(mrb_state* p_state);
+            ~cScript_Profiler();
+
+            // Start measuring a call of `callback'. `fallback' is
+            // used if the location of the proc is not known. Returns
+            // the depth to pass to End().
+            size_t Begin(mrb_value callback, const std::string& fallback);
+            // Start measuring code without a proc, e.g. a script file.
+            size_t Begin(const std::string& location);
+            // Stop measuring the call started with the given depth.
+            // Nested calls an exception jumped over without their
+            // End() are stopped as well.
+            void End(size_t depth);
+
+            // Close the frame. Stops calls which are still measured,
+            // adds the script time to the
+            // performance timer and warns if it exceeds the
+            // budget from the preferences.
+            void End_Frame();
+            // Forget all statistics.
+            void Reset();
+
+            // Microseconds of the last finished frame.
+            uint64_t Get_Last_Frame_Time() const;
+            // Returns the entry with the most time in the last
+            // finished frame or NULL if no script ran.
+            const cScript_Profile_Entry* Get_Last_Frame_Slowest() const;
+            // Returns all entries sorted by the total time.
+            std::vector<const cScript_Profile_Entry*> Get_Entries() const;
+
+        private:
+            struct Running_Call {
+                size_t m_entry;
+                uint64_t m_start_us;
+                size_t m_start_live;
+                // time and objects of the nested calls
+                uint64_t m_nested_us;
+                int64_t m_nested_objects;
+            };
+
+            struct Irep_Location {
+                // keeps the compiled block alive so its address
+                // is not reused while it is a key
+                mrb_value m_proc;
+                std::string m_location;
+            };
+
+            // Returns the entry index for the location.
+            size_t Get_Entry(const std::string& location);
+            // Returns the "file:line" of the proc or an empty string.
+            std::string Get_Location(mrb_value callback);
+            // Start measuring with the given entry index.
+            size_t Begin_Entry(size_t entry);
+            // Stop measuring the last started call.
+            void End_Call();
+            // Release the procs kept for the known locations.
+            void Clear_Irep_Locations();
+
+            mrb_state* mp_mruby;
+            std::vector<cScript_Profile_Entry> m_entries;
+            std::unordered_map<std::string, size_t> m_entry_indices;
+            // known locations of the compiled blocks
+            std::unordered_map<const void*, Irep_Location> m_irep_locations;
+            std::vector<Running_Call> m_running;
+
+            // microseconds of the current frame
+            uint64_t m_frame_us;
+            uint64_t m_last_frame_us;
+            // index of the slowest entry in the last frame or -1
+            int m_last_frame_slowest;
+            // ticks of the last budget warning
+            uint32_t m_last_warning_ticks;
+        };
+    };
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include "scripting.hpp"
 #include "../level/level.hpp"
 #include "../level/level_player.hpp"
+#include "../core/game_core.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../core/property_helper.hpp"
 #include "../core/filesystem/resource_manager.hpp"
@@ -91,11 +92,17 @@ namespace TSC {
 
 namespace Scripting {
 
+cMRuby_Interpreter::Compiled_Script_Map cMRuby_Interpreter::m_compiled_scripts;
+
 cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 {
+    const uint64_t start = TSC_GetMicroTicks();
+
     // Set member variables
     mp_level = p_level;
     mp_mruby = mrb_open();
+    mp_profiler = new cScript_Profiler(mp_mruby);
+    mp_gc_scheduler = new cGC_Scheduler(mp_mruby);
 
     // Create console context (execution context for the game console)
     mp_console_ctx = mrbc_context_new(mp_mruby);
@@ -105,8 +112,11 @@ cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 
     // Load TSC classes into mruby
     Load_Wrappers();
+    const uint64_t wrappers_us = TSC_GetMicroTicks() - start;
     // Load scripting library
     Load_Scripts();
+
+    debug_print("Scripting engine: interpreter created in %.2f ms (wrappers %.2f ms)\n", (TSC_GetMicroTicks() - start) / 1000.0f, wrappers_us / 1000.0f);
 }
 
 cMRuby_Interpreter::~cMRuby_Interpreter()
@@ -148,8 +158,17 @@ cMRuby_Interpreter::~cMRuby_Interpreter()
     // Release console context
     mrbc_context_free(mp_mruby, mp_console_ctx);
 
+    mp_gc_scheduler->Print_Statistics();
+
+    // The profiler releases its procs in the interpreter
+    delete mp_profiler;
+
     // Terminate mruby interpreter
     mrb_close(mp_mruby);
+    delete mp_gc_scheduler;
+
+    // The closed interpreter no longer reads the bytecode
+    m_loaded_binaries.clear();
 }
 
 mrb_state* cMRuby_Interpreter::Get_MRuby_State()
@@ -157,6 +176,16 @@ mrb_state* cMRuby_Interpreter::Get_MRuby_State()
     return mp_mruby;
 }
 
+cScript_Profiler& cMRuby_Interpreter::Get_Profiler()
+{
+    return *mp_profiler;
+}
+
+cGC_Scheduler& cMRuby_Interpreter::Get_GC_Scheduler()
+{
+    return *mp_gc_scheduler;
+}
+
 const mrbc_context* cMRuby_Interpreter::Get_Console_Context() const
 {
     return mp_console_ctx;
@@ -190,7 +219,9 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
     p_context->lineno = 1;
     mrbc_filename(mp_mruby, p_context, contextname.c_str()); // Set context filename (for exceptions)
 
+    const size_t depth = mp_profiler->Begin(contextname);
     Run_Code_In_Context(code, p_context);
+    mp_profiler->End(depth);
 
     bool result;
     if (mp_mruby->exc) {
@@ -210,23 +241,98 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
 
 bool cMRuby_Interpreter::Run_File(const boost::filesystem::path& filepath)
 {
-    // Note we cannot use mrb_load_file(), because we use boost::filesystem’s
-    // filereading capabilities which mruby doesn’t understand. Instead, we
-    // simply pass the read file’s contents to mruby.
-
-    // Open the file.
-    boost::filesystem::ifstream file(filepath);
-    if (!file.is_open()) {
-        cerr << "Failed to open mruby script file '" << path_to_utf8(filepath) << "'" << endl;
-        return false;
+    // Compiled again if the file was modified
+    boost::system::error_code ec;
+    std::time_t write_time = boost::filesystem::last_write_time(filepath, ec);
+    Script_Binary binary;
+
+    Compiled_Script_Map::const_iterator iter = m_compiled_scripts.find(filepath);
+    if (!ec && iter != m_compiled_scripts.end() && iter->second.m_write_time == write_time)
+        binary = iter->second.m_binary;
+
+    std::string code;
+    if (!binary) {
+        // Note we cannot use mrb_load_file(), because we use boost::filesystem’s
+        // filereading capabilities which mruby doesn’t understand. Instead, we
+        // simply pass the read file’s contents to mruby.
+
+        // Open the file.
+        boost::filesystem::ifstream file(filepath);
+        if (!file.is_open()) {
+            cerr << "Failed to open mruby script file '" << path_to_utf8(filepath) << "'" << endl;
+            return false;
+        }
+
+        // Read it.
+        code = readfile(file);
+        file.close();
+    }
+
+    // Same context as Run_Code() so exceptions can be retrieved
+    const std::string contextname = path_to_utf8(filepath.filename());
+    mrbc_context* p_context = mrbc_context_new(mp_mruby);
+    p_context->capture_errors = true;
+    p_context->lineno = 1;
+    mrbc_filename(mp_mruby, p_context, contextname.c_str());
+
+    // Compile it.
+    if (!binary)
+        binary = Compile_Script(filepath, ec ? 0 : write_time, code, p_context);
+
+    // Execute it.
+    if (binary) {
+        // mruby keeps pointing into the binary
+        m_loaded_binaries.push_back(binary);
+
+        const size_t depth = mp_profiler->Begin(contextname);
+        mrb_load_irep_cxt(mp_mruby, &(*binary)[0], p_context);
+        mp_profiler->End(depth);
+    }
+
+    bool result;
+    if (mp_mruby->exc) {
+        // Exception occured
+        gp_game_console->Display_Exception(mp_mruby);
+
+        // Clear exception pointer so execution can continue
+        mp_mruby->exc = NULL;
+        result = false;
+    }
+    else
+        result = binary.get() != NULL;
+
+    mrbc_context_free(mp_mruby, p_context);
+    return result;
+}
+
+cMRuby_Interpreter::Script_Binary cMRuby_Interpreter::Compile_Script(const boost::filesystem::path& filepath, std::time_t write_time, const std::string& code, mrbc_context* p_context)
+{
+    // Only compile, the caller runs the bytecode.
+    p_context->no_exec = true;
+    mrb_value proc = mrb_load_nstring_cxt(mp_mruby, code.c_str(), code.length(), p_context);
+    p_context->no_exec = false;
+
+    // Syntax error
+    if (mp_mruby->exc || mrb_type(proc) != MRB_TT_PROC)
+        return Script_Binary();
+
+    // Keep the line numbers for backtraces and Proc#source_location
+    uint8_t* p_binary = NULL;
+    size_t binary_size = 0;
+    if (mrb_dump_irep(mp_mruby, mrb_proc_ptr(proc)->body.irep, DUMP_DEBUG_INFO, &p_binary, &binary_size) != MRB_DUMP_OK) {
+        cerr << "Failed to compile mruby script file '" << path_to_utf8(filepath) << "'" << endl;
+        return Script_Binary();
     }
 
-    // Read it.
-    std::string code = readfile(file);
-    file.close();
+    // Interpreters still running the old binary keep it alive
+    Script_Binary binary(new std::vector<uint8_t>(p_binary, p_binary + binary_size));
+    mrb_free(mp_mruby, p_binary);
 
-    // Compile & execute it.
-    return Run_Code(code, path_to_utf8(filepath.filename()).c_str());
+    Compiled_Script& script = m_compiled_scripts[filepath];
+    script.m_write_time = write_time;
+    script.m_binary = binary;
+
+    return binary;
 }
 
 void cMRuby_Interpreter::Load_Scripts()
@@ -308,7 +414,10 @@ void cMRuby_Interpreter::Evaluate_Timer_Callbacks()
     // and evaluate each one
     std::vector<mrb_value>::iterator iter;
     for (iter = m_callbacks.begin(); iter != m_callbacks.end(); iter++) {
+        const size_t depth = mp_profiler->Begin(*iter, "timer");
         mrb_funcall(mp_mruby, *iter, "call", 0);
+        mp_profiler->End(depth);
+
         if (mp_mruby->exc) {
             // Exception occured
             gp_game_console->Display_Exception(mp_mruby);
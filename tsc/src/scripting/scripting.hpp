@@ -17,6 +17,8 @@
 #include "../core/global_basic.hpp"
 #include "../core/global_game.hpp"
 #include "objects/mrb_tsc.hpp"
+#include "script_profiler.hpp"
+#include "gc_scheduler.hpp"
 
 // Some defines to ease use of mruby
 #define MRB_ARGUMENT_ERROR(mrb) (mrb_class_get(mrb, "ArgumentError"))
@@ -72,7 +74,8 @@ namespace TSC {
             bool Run_Code(const std::string& code, const std::string& contextname);
             // Execute MRuby code found in a file, using the filename
             // as the context name. Otherwise has the same
-            // semantics as Run_Code().
+            // semantics as Run_Code(). The compiled code is kept
+            // for the following interpreters until the file changes.
             bool Run_File(const boost::filesystem::path& filepath);
             // Execute MRuby code in the given parsing context.
             // This method only does raw code execution, no
@@ -99,13 +102,47 @@ namespace TSC {
             mrb_int Protect_From_GC(mrb_value obj);
             // Release the protection for an object created with Protect_From_GC().
             void Unprotect_From_GC(mrb_int index);
+            // Returns the time measurement of the callbacks.
+            cScript_Profiler& Get_Profiler();
+            // Returns the garbage collection scheduling.
+            cGC_Scheduler& Get_GC_Scheduler();
         private:
             mrb_state* mp_mruby;
+            cScript_Profiler* mp_profiler;
+            cGC_Scheduler* mp_gc_scheduler;
             mrbc_context* mp_console_ctx;
             cLevel* mp_level;
             std::vector<mrb_value> m_callbacks;
             boost::mutex m_callback_mutex;
 
+            /* Bytecode of a script file. mruby reads the ireps
+             * directly from it, so a published binary is never
+             * changed. A modified script gets a new one.
+             */
+            typedef std::shared_ptr<const std::vector<uint8_t> > Script_Binary;
+
+            struct Compiled_Script {
+                std::time_t m_write_time;
+                Script_Binary m_binary;
+            };
+            typedef std::map<boost::filesystem::path, Compiled_Script> Compiled_Script_Map;
+
+            // Compile the code and add it to the compiled scripts.
+            // Returns an empty pointer and leaves the exception in
+            // the mruby state if it could not be compiled.
+            Script_Binary Compile_Script(const boost::filesystem::path& filepath, std::time_t write_time, const std::string& code, mrbc_context* p_context);
+
+            // Binaries loaded into this interpreter, kept until
+            // it is closed
+            std::vector<Script_Binary> m_loaded_binaries;
+
+            /* The standard scripting library is the same for every
+             * level, so it is compiled once and all following
+             * interpreters load the bytecode. Only used from the
+             * main thread.
+             */
+            static Compiled_Script_Map m_compiled_scripts;
+
             // Load all MRuby wrapper classes for the C++ classes
             // into the given mruby state.
             void Load_Wrappers();
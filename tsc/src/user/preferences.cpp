@@ -20,6 +20,7 @@
 #include "../core/game_core.hpp"
 #include "../input/joystick.hpp"
 #include "../level/level_manager.hpp"
+#include "../core/framerate.hpp"
 #include "../core/i18n.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/filesystem.hpp"
@@ -40,6 +41,8 @@ const bool cPreferences::m_always_run_default = 0;
 const std::string cPreferences::m_menu_level_default = "menu_brown_1";
 const float cPreferences::m_camera_hor_speed_default = 0.3f;
 const float cPreferences::m_camera_ver_speed_default = 0.2f;
+const bool cPreferences::m_fixed_timestep_default = 0;
+const float cPreferences::m_script_budget_default = 0.0f;
 // Video
 const bool cPreferences::m_video_fullscreen_default = 0;
 const uint16_t cPreferences::m_video_screen_w_default = 1024;
@@ -144,6 +147,8 @@ void cPreferences::Save(void)
     Add_Property(p_root, "game_menu_level", m_menu_level);
     Add_Property(p_root, "game_camera_hor_speed", m_camera_hor_speed);
     Add_Property(p_root, "game_camera_ver_speed", m_camera_ver_speed);
+    Add_Property(p_root, "game_fixed_timestep", m_fixed_timestep);
+    Add_Property(p_root, "game_script_budget", m_script_budget);
     // Video
     Add_Property(p_root, "video_fullscreen", m_video_fullscreen);
     Add_Property(p_root, "video_screen_w", m_video_screen_w);
@@ -227,6 +232,8 @@ void cPreferences::Reset_Game(void)
     m_menu_level = m_menu_level_default;
     m_camera_hor_speed = m_camera_hor_speed_default;
     m_camera_ver_speed = m_camera_ver_speed_default;
+    m_fixed_timestep = m_fixed_timestep_default;
+    m_script_budget = m_script_budget_default;
 }
 
 void cPreferences::Reset_Video(void)
@@ -323,6 +330,7 @@ void cPreferences::Apply(void)
 {
     pLevel_Manager->m_camera->m_hor_offset_speed = m_camera_hor_speed;
     pLevel_Manager->m_camera->m_ver_offset_speed = m_camera_ver_speed;
+    pFramerate->Set_Fixed_Timestep(m_fixed_timestep);
 
     // disable joystick if the joystick initialization failed
     if (pVideo->m_joy_init_failed) {
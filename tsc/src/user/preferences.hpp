@@ -69,6 +69,10 @@ namespace TSC {
         // smart camera speed
         float m_camera_hor_speed;
         float m_camera_ver_speed;
+        // update the game logic with a fixed timestep and interpolate drawing
+        bool m_fixed_timestep;
+        // warn if the level scripts take more milliseconds in a frame, 0 = disabled
+        float m_script_budget;
 
         // Audio
         bool m_audio_music;
@@ -151,6 +155,8 @@ namespace TSC {
         static const std::string m_menu_level_default;
         static const float m_camera_hor_speed_default;
         static const float m_camera_ver_speed_default;
+        static const bool m_fixed_timestep_default;
+        static const float m_script_budget_default;
         // Audio
         static const bool m_audio_music_default;
         static const bool m_audio_sound_default;
@@ -126,6 +126,10 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_camera_hor_speed = string_to_float(value);
     else if (name == "game_camera_ver_speed" || name == "camera_ver_speed")
         mp_preferences->m_camera_ver_speed = string_to_float(value);
+    else if (name == "game_fixed_timestep")
+        mp_preferences->m_fixed_timestep = string_to_bool(value);
+    else if (name == "game_script_budget")
+        mp_preferences->m_script_budget = string_to_float(value);
     //////////////////// Video ////////////////////
     else if (name == "video_screen_h") {
         val = string_to_int(value);
@@ -43,6 +43,16 @@ namespace TSC {
 
 cAnimation::cAnimation(cSprite_Manager* sprite_manager, std::string type_name /* = "sprite" */)
     : cMovingSprite(sprite_manager, type_name)
+{
+    cAnimation::Init();
+}
+
+cAnimation::~cAnimation(void)
+{
+    //
+}
+
+void cAnimation::Init(void)
 {
     m_sprite_array = ARRAY_ANIM;
     m_type = TYPE_ACTIVE_SPRITE;
@@ -58,11 +68,6 @@ cAnimation::cAnimation(cSprite_Manager* sprite_manager, std::string type_name /*
     m_fading_speed = 1.0f;
 }
 
-cAnimation::~cAnimation(void)
-{
-    //
-}
-
 void cAnimation::Init_Anim(void)
 {
     // virtual
@@ -107,22 +112,11 @@ cAnimation_Goldpiece::cAnimation_Goldpiece(cSprite_Manager* sprite_manager, floa
     Add_Image(pVideo->Get_Surface("animation/light_1/2.png"));
     Add_Image(pVideo->Get_Surface("animation/light_1/3.png"));
 
-    Set_Pos(posx, posy, 1);
-    m_rect.m_w = width;
-    m_rect.m_h = height;
-
     for (unsigned int i = 0; i < 4; i++) {
-        cSprite* obj = new cSprite(m_sprite_manager);
-        obj->Set_Image(m_images[0].m_image);
-        obj->Set_Pos(m_pos_x + Get_Random_Float(0.0f, m_rect.m_w), m_pos_y + Get_Random_Float(0.0f, m_rect.m_h));
-        obj->m_pos_z = m_pos_z;
-        obj->Set_Scale_X(m_scale_x, 1);
-        obj->Set_Scale_Y(m_scale_y, 1);
-        obj->Set_Color(m_color);
-        obj->Set_Color_Combine(m_combine_color[0], m_combine_color[1], m_combine_color[2], m_combine_type);
-
-        m_objects.push_back(obj);
+        m_objects.push_back(new cSprite(m_sprite_manager));
     }
+
+    Init_Points(posx, posy, height, width);
 }
 
 cAnimation_Goldpiece::~cAnimation_Goldpiece(void)
@@ -135,6 +129,51 @@ cAnimation_Goldpiece::~cAnimation_Goldpiece(void)
     m_objects.clear();
 }
 
+cAnimation_Goldpiece* cAnimation_Goldpiece::Create(cSprite_Manager* sprite_manager, float posx, float posy, float height /* = 40.0f */, float width /* = 20.0f */)
+{
+    cSprite_Pool<cAnimation_Goldpiece>& pool = pActive_Animation_Manager->m_goldpiece_pool;
+    cAnimation_Goldpiece* anim = pool.Take();
+
+    if (anim) {
+        anim->Reset_Recycled(sprite_manager);
+        anim->cMovingSprite::Init();
+        anim->cAnimation::Init();
+
+        for (BlinkPointList::iterator itr = anim->m_objects.begin(); itr != anim->m_objects.end(); ++itr) {
+            (*itr)->Reset_Recycled(sprite_manager);
+        }
+
+        anim->Init_Points(posx, posy, height, width);
+    }
+    else {
+        anim = new cAnimation_Goldpiece(sprite_manager, posx, posy, height, width);
+        pool.Count_Allocation();
+    }
+
+    anim->m_pool = &pool;
+
+    return anim;
+}
+
+void cAnimation_Goldpiece::Init_Points(float posx, float posy, float height, float width)
+{
+    Set_Pos(posx, posy, 1);
+    m_rect.m_w = width;
+    m_rect.m_h = height;
+
+    for (BlinkPointList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        obj->Set_Image(m_images[0].m_image);
+        obj->Set_Pos(m_pos_x + Get_Random_Float(0.0f, m_rect.m_w), m_pos_y + Get_Random_Float(0.0f, m_rect.m_h));
+        obj->m_pos_z = m_pos_z;
+        obj->Set_Scale_X(m_scale_x, 1);
+        obj->Set_Scale_Y(m_scale_y, 1);
+        obj->Set_Color(m_color);
+        obj->Set_Color_Combine(m_combine_color[0], m_combine_color[1], m_combine_color[2], m_combine_type);
+    }
+}
+
 void cAnimation_Goldpiece::Update(void)
 {
     if (!m_active || editor_enabled) {
@@ -246,16 +285,70 @@ cAnimation_Fireball::cAnimation_Fireball(cSprite_Manager* sprite_manager, float
     : cAnimation(sprite_manager)
 {
     Set_Pos(posx, posy, 1);
+    Init_Items(power);
+}
+
+cAnimation_Fireball::~cAnimation_Fireball(void)
+{
+    // clear
+    for (FireAnimList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
+        delete *itr;
+    }
+
+    m_objects.clear();
+}
+
+cAnimation_Fireball* cAnimation_Fireball::Create(cSprite_Manager* sprite_manager, float posx, float posy, unsigned int power /* = 5 */)
+{
+    cSprite_Pool<cAnimation_Fireball>& pool = pActive_Animation_Manager->m_fireball_pool;
+    cAnimation_Fireball* anim = pool.Take();
+
+    if (anim) {
+        anim->Reset_Recycled(sprite_manager);
+        anim->cMovingSprite::Init();
+        anim->cAnimation::Init();
+        anim->Set_Pos(posx, posy, 1);
+        anim->Init_Items(power);
+    }
+    else {
+        anim = new cAnimation_Fireball(sprite_manager, posx, posy, power);
+        pool.Count_Allocation();
+    }
+
+    anim->m_pool = &pool;
+
+    return anim;
+}
+
+void cAnimation_Fireball::Init_Items(unsigned int power)
+{
+    // remove unneeded items
+    while (m_objects.size() > power) {
+        delete m_objects.back();
+        m_objects.pop_back();
+    }
 
-    // create objects
     for (unsigned int i = 0; i < power; i++) {
-        cAnimation_Fireball_Item* obj = new cAnimation_Fireball_Item(sprite_manager);
+        cAnimation_Fireball_Item* obj;
+
+        // reuse the item and its images
+        if (i < m_objects.size()) {
+            obj = m_objects[i];
+            obj->Reset_Recycled(m_sprite_manager);
+            obj->cMovingSprite::Init();
+        }
+        else {
+            obj = new cAnimation_Fireball_Item(m_sprite_manager);
+
+            // images
+            obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_4.png"));
+            obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_3.png"));
+            obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_2.png"));
+            obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_1.png"));
+
+            m_objects.push_back(obj);
+        }
 
-        // images
-        obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_4.png"));
-        obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_3.png"));
-        obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_2.png"));
-        obj->Add_Image(pVideo->Get_Surface("animation/particles/fire_1.png"));
         obj->Set_Image_Num(0);
 
         // velocity
@@ -270,21 +363,9 @@ cAnimation_Fireball::cAnimation_Fireball(cSprite_Manager* sprite_manager, float
 
         // lifetime
         obj->m_counter = Get_Random_Float(8, 13);
-
-        m_objects.push_back(obj);
     }
 }
 
-cAnimation_Fireball::~cAnimation_Fireball(void)
-{
-    // clear
-    for (FireAnimList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        delete *itr;
-    }
-
-    m_objects.clear();
-}
-
 void cAnimation_Fireball::Update(void)
 {
     if (!m_active || editor_enabled) {
@@ -579,6 +660,7 @@ void cParticle_Emitter::Init(void)
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 
     // 0 = 1 emit
     m_emitter_time_to_live = 0.0f;
@@ -1214,6 +1296,7 @@ void cParticle_Emitter::Set_Emitter_Rect(float x, float y, float w /* = 0 */, fl
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
+    Update_Editor_Index();
 }
 
 void cParticle_Emitter::Set_Emitter_Rect(const GL_rect& rect)
@@ -2121,23 +2204,28 @@ cAnimation_Manager::~cAnimation_Manager(void)
 
 void cAnimation_Manager::Update(void)
 {
-    for (cAnimation_List::iterator itr = objects.begin(); itr != objects.end();) {
+    // number of kept objects, the finished ones are removed in one pass
+    size_t kept = 0;
+
+    // an update may add animations
+    for (size_t i = 0; i < objects.size(); i++) {
         // get object pointer
-        cAnimation* obj = (*itr);
+        cAnimation* obj = objects[i];
 
         // update
         obj->Update();
 
         // delete if finished
         if (!obj->m_active) {
-            itr = objects.erase(itr);
-            delete obj;
+            cSprite_Pool_Base::Release_Or_Delete(obj);
         }
-        // increment
         else {
-            ++itr;
+            objects[kept] = obj;
+            kept++;
         }
     }
+
+    objects.resize(kept);
 }
 
 void cAnimation_Manager::Draw(void)
@@ -19,6 +19,7 @@
 
 #include "../objects/movingsprite.hpp"
 #include "../core/obj_manager.hpp"
+#include "../core/sprite_pool.hpp"
 
 namespace TSC {
 
@@ -38,6 +39,9 @@ namespace TSC {
         cAnimation(cSprite_Manager* sprite_manager, std::string type_name = "sprite");
         virtual ~cAnimation(void);
 
+        // init defaults
+        void Init(void);
+
         // initialize animation
         virtual void Init_Anim(void);
         // update animation
@@ -77,6 +81,13 @@ namespace TSC {
         cAnimation_Goldpiece(cSprite_Manager* sprite_manager, float posx, float posy, float height = 40.0f, float width = 20.0f);
         virtual ~cAnimation_Goldpiece(void);
 
+        /* Return an animation from the pool of the active animation manager or a new one
+         * it must be added to the active animation manager
+        */
+        static cAnimation_Goldpiece* Create(cSprite_Manager* sprite_manager, float posx, float posy, float height = 40.0f, float width = 20.0f);
+        // Set the position and size and place the blinking points again
+        void Init_Points(float posx, float posy, float height, float width);
+
         // update
         virtual void Update(void);
         // draw
@@ -107,6 +118,15 @@ namespace TSC {
         cAnimation_Fireball(cSprite_Manager* sprite_manager, float posx, float posy, unsigned int power = 5);
         virtual ~cAnimation_Fireball(void);
 
+        /* Return an animation from the pool of the active animation manager or a new one
+         * it must be added to the active animation manager
+        */
+        static cAnimation_Fireball* Create(cSprite_Manager* sprite_manager, float posx, float posy, unsigned int power = 5);
+        /* Set the number of fire items and start them again
+         * the items of a recycled animation are reused with their images
+        */
+        void Init_Items(unsigned int power);
+
         // update
         virtual void Update(void);
         // draw
@@ -388,12 +408,18 @@ namespace TSC {
         // Add an animation object with the given settings
         virtual void Add(cAnimation* animation);
 
-        // Update the objects
+        /* Update the objects
+         * finished animations are given back to their pool or deleted
+        */
         void Update(void);
         // Draw the objects
         void Draw(void);
 
         typedef vector<cAnimation*> cAnimation_List;
+
+        // released animations
+        cSprite_Pool<cAnimation_Fireball> m_fireball_pool;
+        cSprite_Pool<cAnimation_Goldpiece> m_goldpiece_pool;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -17,6 +17,7 @@
 #include "../video/img_manager.hpp"
 #include "../video/renderer.hpp"
 #include "../video/loading_screen.hpp"
+#include "../video/img_set.hpp"
 #include "../core/i18n.hpp"
 #include "../core/global_basic.hpp"
 #include "../core/property_helper.hpp"
@@ -253,6 +254,8 @@ void cImage_Manager::Delete_All(void)
     Delete_Image_Textures();
     cObject_Manager<cGL_Surface>::Delete_All();
     m_index_table.clear();
+    // the cached image sets reference the deleted surfaces
+    cImageSet::Clear_Definition_Cache();
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -29,6 +29,11 @@ namespace fs = boost::filesystem;
 
 namespace TSC {
 
+/* Parsed image set files by pixmap path and default time
+ * the frames are referenced by the image sets so entries are never removed alone
+*/
+static std::unordered_map<std::string, cImageSet::Definition> s_definition_cache;
+
 /* *** *** *** *** *** *** *** cImageSet::FrameInfo *** *** *** *** *** *** *** *** *** *** */
 cImageSet::FrameInfo::FrameInfo()
 {
@@ -107,6 +112,9 @@ cImageSet::Surface::Surface(void)
 {
     m_image = NULL;
     m_time = 0;
+    m_time_min = 0;
+    m_time_max = 0;
+    m_info = NULL;
 }
 
 cImageSet::Surface::~Surface(void)
@@ -117,17 +125,17 @@ cImageSet::Surface::~Surface(void)
 void cImageSet::Surface::Enter(void)
 {
     // set random time for this frame
-    m_time = m_info.m_time_min + rand() % (m_info.m_time_max - m_info.m_time_min + 1);
+    m_time = m_time_min + rand() % (m_time_max - m_time_min + 1);
 }
 
 int cImageSet::Surface::Leave(void)
 {
     // determine any branching to other frames
-    if(m_info.m_branches.size() == 0)
+    if(!m_info || m_info->m_branches.size() == 0)
         return -1;
 
     int rnd = (rand() % 100) + 1; // 1 to 100 inclusive
-    for(FrameInfo::List_Type::iterator it = m_info.m_branches.begin(); it != m_info.m_branches.end(); ++it)
+    for(FrameInfo::List_Type::const_iterator it = m_info->m_branches.begin(); it != m_info->m_branches.end(); ++it)
     {
         // first is frame number, second is percentage
         if(rnd <= it->second) {
@@ -173,8 +181,8 @@ void cImageSet::Add_Image(cGL_Surface* image, uint32_t time /* = 0 */)
     obj.m_time = time;
 
     // we may not be adding from an image set, so set up some initial information
-    obj.m_info.m_time_min = time;
-    obj.m_info.m_time_max = time;
+    obj.m_time_min = time;
+    obj.m_time_max = time;
 
     m_images.push_back(obj);
 }
@@ -201,34 +209,25 @@ bool cImageSet::Add_Image_Set(const std::string& name, boost::filesystem::path p
         }
     }
     else {
-        // Parse the animation file
-        filename = pResource_Manager->Get_Game_Pixmap(path_to_utf8(path));
+        // Parsed only once for all image sets
+        const Definition* definition = Get_Definition(path, time);
 
-        if(!fs::exists(filename)) {
+        if (!definition) {
             cerr << "Warning: Unable to load image set: " << name << " " << Get_Identity() << endl;
             return false;
         }
 
-        Parser parser(time);
-        if(!parser.Parse(path_to_utf8(filename))) {
-            cerr << "Warning: Unable to parse image set: " << filename << endl;
-            return false;
-        }
-
-        if(parser.m_images.size() == 0) {
-            cerr << "Warning: Empty image set: " << filename << endl;
-            return false;
-        }
+        filename = path;
 
         // Add images
-        for(Parser::List_Type::iterator itr = parser.m_images.begin(); itr != parser.m_images.end(); ++itr) {
-            cGL_Surface* surface = pVideo->Get_Surface(itr->m_filename);
-            if(surface) {
-                Add_Image(surface, itr->m_time_min);
-
-                // update info
-                m_images.back().m_info = *itr;
-            }
+        for(unsigned int i = 0; i < definition->m_frames.size(); i++) {
+            Add_Image(definition->m_surfaces[i], definition->m_frames[i].m_time_min);
+
+            // update info
+            Surface& surface = m_images.back();
+            surface.m_time_min = definition->m_frames[i].m_time_min;
+            surface.m_time_max = definition->m_frames[i].m_time_max;
+            surface.m_info = &definition->m_frames[i];
         }
     }
     end = m_images.size() - 1;
@@ -378,8 +377,8 @@ void cImageSet::Set_Time_All(const uint32_t time, const bool default_time /* = 0
     for (Surface_List::iterator itr = m_images.begin(); itr != m_images.end(); ++itr) {
         Surface& obj = (*itr);
         obj.m_time = time;
-        obj.m_info.m_time_min = time;
-        obj.m_info.m_time_max = time;
+        obj.m_time_min = time;
+        obj.m_time_max = time;
     }
 
     if (default_time) {
@@ -387,6 +386,54 @@ void cImageSet::Set_Time_All(const uint32_t time, const bool default_time /* = 0
     }
 }
 
+/* static */
+const cImageSet::Definition* cImageSet::Get_Definition(const fs::path& path, uint32_t time)
+{
+    const std::string key = path_to_utf8(path) + ":" + uint_to_string(time);
+
+    std::unordered_map<std::string, Definition>::const_iterator cache_itr = s_definition_cache.find(key);
+
+    if (cache_itr != s_definition_cache.end()) {
+        return &cache_itr->second;
+    }
+
+    // Parse the animation file
+    fs::path filename = pResource_Manager->Get_Game_Pixmap(path_to_utf8(path));
+
+    if(!fs::exists(filename)) {
+        return NULL;
+    }
+
+    Parser parser(time);
+    if(!parser.Parse(path_to_utf8(filename))) {
+        cerr << "Warning: Unable to parse image set: " << filename << endl;
+        return NULL;
+    }
+
+    if(parser.m_images.size() == 0) {
+        cerr << "Warning: Empty image set: " << filename << endl;
+        return NULL;
+    }
+
+    Definition definition;
+
+    for(Parser::List_Type::iterator itr = parser.m_images.begin(); itr != parser.m_images.end(); ++itr) {
+        cGL_Surface* surface = pVideo->Get_Surface(itr->m_filename);
+        if(surface) {
+            definition.m_frames.push_back(*itr);
+            definition.m_surfaces.push_back(surface);
+        }
+    }
+
+    return &(s_definition_cache[key] = definition);
+}
+
+/* static */
+void cImageSet::Clear_Definition_Cache(void)
+{
+    s_definition_cache.clear();
+}
+
 /* static */
 cGL_Surface* cImageSet::Fetch_Single_Image(const fs::path& path, int idx /*= 0*/)
 {
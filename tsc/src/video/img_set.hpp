@@ -41,6 +41,17 @@ namespace TSC {
             List_Type m_branches;
         };
 
+        /* *** *** *** *** *** *** *** Definition *** *** *** *** *** *** *** *** *** *** */
+
+        /* Parsed image set file with its frame surfaces
+         * shared by all image sets using the same file and never changed after loading
+        */
+        struct Definition {
+            // frames which have a surface
+            std::vector<FrameInfo> m_frames;
+            std::vector<cGL_Surface*> m_surfaces;
+        };
+
         /* *** *** *** *** *** *** *** Parser *** *** *** *** *** *** *** *** *** *** */
         class Parser : public cFile_parser
         {
@@ -71,8 +82,11 @@ namespace TSC {
             cGL_Surface* m_image;
             // time to display in milliseconds
             uint32_t m_time;
-            // information
-            FrameInfo m_info;
+            // range of the random display time
+            uint32_t m_time_min;
+            uint32_t m_time_max;
+            // shared information from the image set file or NULL
+            const FrameInfo* m_info;
         };
 
 
@@ -149,6 +163,16 @@ namespace TSC {
         /* Fetch a single image from another image set. */
         static cGL_Surface* Fetch_Single_Image(const boost::filesystem::path& path, int idx = 0);
 
+        /* Return the parsed image set file from the cache or load it
+         * time: default display time of the frames
+         * returns NULL if the file could not be loaded or has no frames
+        */
+        static const Definition* Get_Definition(const boost::filesystem::path& path, uint32_t time);
+        /* Delete all cached image set files
+         * must be called if the surfaces they reference get deleted
+        */
+        static void Clear_Definition_Cache(void);
+
         // currently set image array number
         int m_curr_img;
         // if animation is enabled
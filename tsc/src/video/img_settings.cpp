@@ -19,6 +19,8 @@
 #include "../core/math/utilities.hpp"
 #include "../core/math/size.hpp"
 #include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/relative.hpp"
+#include "../core/property_helper.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -238,6 +240,89 @@ void cImage_Settings_Data::Apply_Base(const cImage_Settings_Data* base_settings_
 
 /* *** *** *** *** *** *** cImage_Settings_Parser *** *** *** *** *** *** *** *** *** *** *** */
 
+// resolved settings of a file
+struct cSettings_Cache_Entry {
+    cImage_Settings_Data m_data;
+    // the file and all base settings files
+    cImage_Settings_Parser::FileTimeList m_files;
+};
+
+typedef std::unordered_map<std::string, cSettings_Cache_Entry> SettingsCache;
+// shared by all parsers, keyed by the settings file path
+static SettingsCache s_settings_cache;
+
+// Return true if none of the files changed
+static bool Is_Up_To_Date(const cImage_Settings_Parser::FileTimeList& files)
+{
+    for (cImage_Settings_Parser::FileTimeList::const_iterator itr = files.begin(); itr != files.end(); ++itr) {
+        boost::system::error_code ec;
+
+        if (fs::last_write_time(itr->first, ec) != itr->second || ec) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Reads the index written by Save_Index
+ * Every entry starts with a file line followed by its resolved settings :
+ * file <path> <mtime> [<base settings path> <mtime>]...
+*/
+class cImage_Settings_Index_Parser : public cImage_Settings_Parser {
+public:
+    cImage_Settings_Index_Parser(const fs::path& directory)
+        : cImage_Settings_Parser(), m_directory(directory)
+    {
+        // the settings are already resolved
+        m_load_base = 0;
+        m_entry = NULL;
+        m_valid = 1;
+    }
+
+    virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
+    {
+        if (parts[0].compare("file") == 0) {
+            if (count < 3 || count % 2 == 0) {
+                cerr << path_to_utf8(Trim_Filename(data_file, 0, 0)) << " : line " << line << " Error : ";
+                cerr << parts[0] << " needs a path and modification time pairs" << endl;
+                m_entry = NULL;
+                m_valid = 0;
+                return 0;
+            }
+
+            m_entry = &s_settings_cache[path_to_utf8(m_directory / utf8_to_path(parts[1]))];
+            m_entry->m_data = cImage_Settings_Data();
+            m_entry->m_files.clear();
+
+            for (unsigned int i = 1; i + 1 < count; i += 2) {
+                m_entry->m_files.push_back(std::make_pair(m_directory / utf8_to_path(parts[i]), static_cast<std::time_t>(string_to_int64(parts[i + 1]))));
+            }
+
+            return 1;
+        }
+
+        // settings without file line
+        if (!m_entry) {
+            return 0;
+        }
+
+        m_settings_temp = &m_entry->m_data;
+        bool success = cImage_Settings_Parser::HandleMessage(parts, count, line);
+        m_settings_temp = NULL;
+
+        return success;
+    }
+
+    // paths in the index are relative to it
+    fs::path m_directory;
+    // entry the settings are added to
+    cSettings_Cache_Entry* m_entry;
+    // set if a file line could not be parsed
+    bool m_valid;
+};
+
+
 cImage_Settings_Parser::cImage_Settings_Parser(void)
     : cFile_parser()
 {
@@ -252,12 +337,37 @@ cImage_Settings_Parser::~cImage_Settings_Parser(void)
 
 cImage_Settings_Data* cImage_Settings_Parser::Get(const boost::filesystem::path& filename, bool load_base_settings /* = 1 */)
 {
+    const std::string key = path_to_utf8(filename);
+
+    // only settings with resolved base settings are cached
+    if (load_base_settings) {
+        SettingsCache::const_iterator itr = s_settings_cache.find(key);
+
+        if (itr != s_settings_cache.end() && Is_Up_To_Date(itr->second.m_files)) {
+            m_files = itr->second.m_files;
+            return new cImage_Settings_Data(itr->second.m_data);
+        }
+    }
+
+    boost::system::error_code ec;
+    const std::time_t write_time = fs::last_write_time(filename, ec);
+
+    m_files.clear();
+    m_files.push_back(std::make_pair(filename, write_time));
+
     m_load_base = load_base_settings;
     m_settings_temp = new cImage_Settings_Data();
 
-    Parse(filename);
+    bool success = Parse(filename);
     cImage_Settings_Data* settings = m_settings_temp;
     m_settings_temp = NULL;
+
+    if (success && load_base_settings && !ec) {
+        cSettings_Cache_Entry& entry = s_settings_cache[key];
+        entry.m_data = *settings;
+        entry.m_files = m_files;
+    }
+
     return settings;
 }
 
@@ -300,6 +410,8 @@ bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned in
                     // create new temporary parser
                     cImage_Settings_Parser* temp_parser = new cImage_Settings_Parser();
                     cImage_Settings_Data* base_settings = temp_parser->Get(settings_file);
+                    // the cached settings depend on the base settings files
+                    m_files.insert(m_files.end(), temp_parser->m_files.begin(), temp_parser->m_files.end());
                     // finished loading base settings
                     delete temp_parser;
                     settings_file.clear();
@@ -528,6 +640,92 @@ bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned in
     return 1;
 }
 
+bool cImage_Settings_Parser::Load_Index(const fs::path& directory, const fs::path& filename)
+{
+    // not available in a source tree
+    if (!File_Exists(filename)) {
+        return 0;
+    }
+
+    cImage_Settings_Index_Parser parser(directory);
+
+    if (!parser.Parse(filename)) {
+        return 0;
+    }
+
+    return parser.m_valid;
+}
+
+bool cImage_Settings_Parser::Save_Index(const fs::path& directory, const fs::path& filename)
+{
+    vector<fs::path> settings_files = Get_Directory_Files(directory, ".settings");
+    // same index for the same files
+    std::sort(settings_files.begin(), settings_files.end());
+
+    fs::ofstream ofs(filename, ios::out | ios::trunc);
+
+    if (!ofs) {
+        cerr << "Error : Could not write image settings index " << path_to_utf8(filename) << endl;
+        return 0;
+    }
+
+    ofs << "# Resolved image settings generated from " << path_to_utf8(directory) << endl;
+
+    for (vector<fs::path>::const_iterator itr = settings_files.begin(); itr != settings_files.end(); ++itr) {
+        cImage_Settings_Parser parser;
+        cImage_Settings_Data* settings = parser.Get(*itr);
+
+        ofs << "file";
+
+        for (FileTimeList::const_iterator file_itr = parser.m_files.begin(); file_itr != parser.m_files.end(); ++file_itr) {
+            ofs << " " << path_to_utf8(fs_relative(directory, file_itr->first)) << " " << static_cast<int64_t>(file_itr->second);
+        }
+
+        ofs << endl;
+
+        if (!settings->m_base.empty()) {
+            ofs << "base " << path_to_utf8(settings->m_base) << " " << settings->m_base_settings << endl;
+        }
+
+        ofs << "int_x " << settings->m_int_x << endl;
+        ofs << "int_y " << settings->m_int_y << endl;
+
+        if (settings->m_col_rect.m_w > 0.0f || settings->m_col_rect.m_h > 0.0f) {
+            ofs << "col_rect " << static_cast<int>(settings->m_col_rect.m_x) << " " << static_cast<int>(settings->m_col_rect.m_y) << " " << static_cast<int>(settings->m_col_rect.m_w) << " " << static_cast<int>(settings->m_col_rect.m_h) << endl;
+        }
+
+        ofs << "width " << settings->m_width << endl;
+        ofs << "height " << settings->m_height << endl;
+        ofs << "rotation " << settings->m_rotation_x << " " << settings->m_rotation_y << " " << settings->m_rotation_z << endl;
+        ofs << "mipmap " << settings->m_mipmap << endl;
+
+        if (!settings->m_editor_tags.empty()) {
+            ofs << "editor_tags " << settings->m_editor_tags << endl;
+        }
+        if (!settings->m_name.empty()) {
+            ofs << "name " << settings->m_name << endl;
+        }
+
+        ofs << "type " << Get_Massive_Type_Name(settings->m_massive_type) << endl;
+        ofs << "ground_type " << Get_Ground_Type_Name(settings->m_ground_type) << endl;
+
+        if (!settings->m_author.empty()) {
+            ofs << "author " << settings->m_author << endl;
+        }
+
+        ofs << "obsolete " << settings->m_obsolete << endl;
+
+        delete settings;
+    }
+
+    return ofs.good();
+}
+
+void cImage_Settings_Parser::Clear_Cache(void)
+{
+    s_settings_cache.clear();
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cImage_Settings_Parser* pSettingsParser = NULL;
@@ -73,6 +73,11 @@ namespace TSC {
 
     /* *** *** *** *** *** *** cImage_Settings_Parser *** *** *** *** *** *** *** *** *** *** *** */
 
+    /* Settings with base settings are resolved once and kept in a cache
+     * shared by all parsers. A cached entry is used as long as the
+     * modification time of the file and of all its base settings files
+     * is unchanged. The cache can be filled from a prebuilt index.
+    */
     class cImage_Settings_Parser : public cFile_parser {
     public:
         cImage_Settings_Parser(void);
@@ -87,10 +92,26 @@ namespace TSC {
         // Handle one tokenized line
         virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
 
+        /* Add the resolved settings from the given index file to the cache
+         * directory : the paths in the index are relative to it
+         * returns false if the index does not exist or could not be read
+        */
+        static bool Load_Index(const boost::filesystem::path& directory, const boost::filesystem::path& filename);
+        /* Resolve all settings files in the given directory and save them as index file
+         * returns false if the index could not be written
+        */
+        static bool Save_Index(const boost::filesystem::path& directory, const boost::filesystem::path& filename);
+        // Remove all cached settings
+        static void Clear_Cache(void);
+
         // temp settings used for loading
         cImage_Settings_Data* m_settings_temp;
         // load base settings
         bool m_load_base;
+
+        typedef std::vector<std::pair<boost::filesystem::path, std::time_t> > FileTimeList;
+        // files the last settings were resolved from with their modification time
+        FileTimeList m_files;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -70,6 +70,7 @@ cVideo::cVideo(void)
     mp_default_tooltip = NULL;
 
     m_initialised = 0;
+    m_render_us = 0;
 }
 
 cVideo::~cVideo(void)
@@ -94,6 +95,8 @@ cVideo::~cVideo(void)
         delete mp_window;
         mp_window = NULL;
     }
+
+    Clear_Preloaded_Images();
 }
 
 void cVideo::Init_CEGUI(void)
@@ -710,6 +713,8 @@ void cVideo::Render_From_Thread(void)
 
 void cVideo::Render(bool threaded /* = 0 */)
 {
+    const uint64_t render_start = TSC_GetMicroTicks();
+
     Render_Finish();
 
     if (threaded) {
@@ -718,6 +723,9 @@ void cVideo::Render(bool threaded /* = 0 */)
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+        // the swap can wait for the vertical sync
+        m_render_us = TSC_GetMicroTicks() - render_start;
+
         mp_window->display();
 
         // update performance timer
@@ -752,6 +760,9 @@ void cVideo::Render(bool threaded /* = 0 */)
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
+        // the swap can wait for the vertical sync
+        m_render_us = TSC_GetMicroTicks() - render_start;
+
         mp_window->display();
 
         // update performance timer
@@ -818,7 +829,7 @@ cGL_Surface* cVideo::Get_Surface(fs::path filename, bool print_errors /* = true
     return image;
 }
 
-cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */) const
+cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */)
 {
     // pixmaps dir must be given
     if (!filename.is_absolute()) {
@@ -847,7 +858,7 @@ cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, boo
 
             // check if image cache file exists
             if (fs::exists(img_filename_cache) && fs::is_regular_file(img_filename_cache)) {
-                successfully_loaded = p_sf_image->loadFromFile(path_to_utf8(img_filename_cache));
+                successfully_loaded = Load_Image_File(p_sf_image, img_filename_cache);
 
                 if (successfully_loaded) {
                     final_png_path = img_filename_cache;
@@ -868,7 +879,7 @@ cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, boo
                     }
                 }
 
-                successfully_loaded = p_sf_image->loadFromFile(path_to_utf8(img_filename));
+                successfully_loaded = Load_Image_File(p_sf_image, img_filename);
 
                 if (successfully_loaded) {
                     final_png_path = img_filename;
@@ -879,7 +890,7 @@ cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, boo
 
     // if not set in image settings and file exists
     if (!successfully_loaded && exists(filename) && (!settings || settings->m_base.empty())) {
-        successfully_loaded = p_sf_image->loadFromFile(path_to_utf8(filename));
+        successfully_loaded = Load_Image_File(p_sf_image, filename);
 
         if (successfully_loaded) {
             final_png_path = filename;
@@ -949,6 +960,162 @@ cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_
     return image;
 }
 
+const unsigned int cVideo::m_preload_thread_limit = 8;
+
+void cVideo::Preload_Images(const std::vector<fs::path>& filenames)
+{
+    std::vector<fs::path> files = Get_Preload_Files(filenames);
+
+    if (files.empty()) {
+        return;
+    }
+
+    const uint64_t start = TSC_GetMicroTicks();
+
+    Add_Preloaded_Images(files, Decode_Images(files));
+
+    debug_print("Preloaded %u images in %u ms\n", static_cast<unsigned int>(files.size()), static_cast<unsigned int>((TSC_GetMicroTicks() - start) / 1000));
+}
+
+std::vector<fs::path> cVideo::Get_Preload_Files(const std::vector<fs::path>& filenames) const
+{
+    std::vector<fs::path> files;
+    std::unordered_set<std::string> added;
+
+    // find the png files Load_Image() will read
+    for (std::vector<fs::path>::const_iterator itr = filenames.begin(); itr != filenames.end(); ++itr) {
+        fs::path filename = *itr;
+
+        // .settings file type can't be used directly
+        if (filename.extension() == fs::path(".settings"))
+            filename.replace_extension(".png");
+
+        // pixmaps dir must be given
+        if (!filename.is_absolute()) {
+            filename = pResource_Manager->Get_Game_Pixmaps_Directory() / filename;
+        }
+
+        // already loaded
+        if (pImage_Manager->Get_Pointer(path_to_utf8(filename))) {
+            continue;
+        }
+
+        fs::path settings_file = filename;
+        settings_file.replace_extension(".settings");
+        fs::path png_file = filename;
+
+        if (fs::exists(settings_file) && fs::is_regular_file(settings_file)) {
+            fs::path img_filename_cache = m_imgcache_dir / fs_relative(pResource_Manager->Get_Game_Data_Directory(), filename);
+
+            if (fs::exists(img_filename_cache) && fs::is_regular_file(img_filename_cache)) {
+                png_file = img_filename_cache;
+            }
+            else {
+                cImage_Settings_Data* settings = pSettingsParser->Get(settings_file);
+                const bool has_base = !settings->m_base.empty();
+                delete settings;
+
+                // left to Load_Image()
+                if (has_base) {
+                    continue;
+                }
+            }
+        }
+
+        if (!fs::exists(png_file) || !added.insert(path_to_utf8(png_file)).second) {
+            continue;
+        }
+
+        // taken from an earlier preload
+        if (m_preloaded_images.count(path_to_utf8(png_file))) {
+            continue;
+        }
+
+        files.push_back(png_file);
+    }
+
+    return files;
+}
+
+std::vector<sf::Image*> cVideo::Decode_Images(const std::vector<fs::path>& files)
+{
+    std::vector<sf::Image*> images(files.size(), static_cast<sf::Image*>(NULL));
+    std::atomic<size_t> next_file(0);
+    unsigned int thread_count = boost::thread::hardware_concurrency();
+
+    if (thread_count == 0) {
+        thread_count = 1;
+    }
+    else if (thread_count > m_preload_thread_limit) {
+        thread_count = m_preload_thread_limit;
+    }
+
+    boost::thread_group threads;
+
+    for (unsigned int i = 0; i < thread_count; i++) {
+        threads.create_thread([&files, &images, &next_file]() { Preload_Worker(&files, &images, &next_file); });
+    }
+
+    threads.join_all();
+
+    return images;
+}
+
+void cVideo::Add_Preloaded_Images(const std::vector<fs::path>& files, const std::vector<sf::Image*>& images)
+{
+    for (size_t i = 0; i < files.size(); i++) {
+        if (!images[i]) {
+            continue;
+        }
+
+        std::pair<PreloadedImageMap::iterator, bool> result = m_preloaded_images.insert(PreloadedImageMap::value_type(path_to_utf8(files[i]), images[i]));
+
+        // preloaded again meanwhile
+        if (!result.second) {
+            delete images[i];
+        }
+    }
+}
+
+void cVideo::Clear_Preloaded_Images(void)
+{
+    for (PreloadedImageMap::iterator itr = m_preloaded_images.begin(); itr != m_preloaded_images.end(); ++itr) {
+        delete itr->second;
+    }
+
+    m_preloaded_images.clear();
+}
+
+bool cVideo::Load_Image_File(sf::Image*& p_sf_image, const fs::path& filename)
+{
+    PreloadedImageMap::iterator itr = m_preloaded_images.find(path_to_utf8(filename));
+
+    // take the decoded image instead of copying its pixels
+    if (itr != m_preloaded_images.end()) {
+        delete p_sf_image;
+        p_sf_image = itr->second;
+        m_preloaded_images.erase(itr);
+        return 1;
+    }
+
+    return p_sf_image->loadFromFile(path_to_utf8(filename));
+}
+
+void cVideo::Preload_Worker(const std::vector<fs::path>* files, std::vector<sf::Image*>* images, std::atomic<size_t>* next_file)
+{
+    // only decodes and does not touch the shared managers
+    for (size_t i = (*next_file)++; i < files->size(); i = (*next_file)++) {
+        sf::Image* p_sf_image = new sf::Image();
+
+        if (p_sf_image->loadFromFile(path_to_utf8((*files)[i]))) {
+            (*images)[i] = p_sf_image;
+        }
+        else {
+            delete p_sf_image;
+        }
+    }
+}
+
 /**
  * OpenGL only understands textures whose edges each have a length
  * that is a power of 2. This function ensures that our images fulfill
@@ -2012,4 +2179,16 @@ cVideo* pVideo = NULL;
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
+cImage_Preload::cImage_Preload(const std::vector<fs::path>& filenames)
+{
+    pVideo->Preload_Images(filenames);
+}
+
+cImage_Preload::~cImage_Preload(void)
+{
+    pVideo->Clear_Preloaded_Images();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
 } // namespace TSC
@@ -121,7 +121,7 @@ namespace TSC {
          * load_settings : enable file settings if set to 1
          * print_errors : print errors if image couldn't be created or loaded
         */
-        cSoftware_Image Load_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1) const;
+        cSoftware_Image Load_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1);
 
         /* Load and return the hardware image
          * use_settings : enable file settings if set to 1
@@ -130,6 +130,21 @@ namespace TSC {
         */
         cGL_Surface* Load_GL_Surface(boost::filesystem::path filename, bool use_settings = 1, bool print_errors = 1);
 
+        /* Decode the given image files on worker threads
+         * Load_Image() takes the decoded images instead of reading the files again
+         * images which are already loaded or have base settings are skipped
+        */
+        void Preload_Images(const std::vector<boost::filesystem::path>& filenames);
+        /* The steps of Preload_Images() for decoding the images without blocking
+         * Get_Preload_Files() and Add_Preloaded_Images() must be called from the main thread
+         * Decode_Images() can run on any thread and returns NULL for files which failed to decode
+        */
+        std::vector<boost::filesystem::path> Get_Preload_Files(const std::vector<boost::filesystem::path>& filenames) const;
+        static std::vector<sf::Image*> Decode_Images(const std::vector<boost::filesystem::path>& files);
+        void Add_Preloaded_Images(const std::vector<boost::filesystem::path>& files, const std::vector<sf::Image*>& images);
+        // Delete the preloaded images which were not used
+        void Clear_Preloaded_Images(void);
+
         /* Convert to a scaled software image with a power of 2 size and 32 bits per pixel.
          * Conversion only happens if needed.
          * surface : the source image which gets converted if needed
@@ -255,6 +270,23 @@ namespace TSC {
 
         // if set video is initialized successfully
         bool m_initialised;
+        // microseconds the last Render() took before swapping the buffer
+        uint64_t m_render_us;
+
+    private:
+        /* Load the image file into the given image
+         * takes the preloaded image if available, which replaces the given image
+        */
+        bool Load_Image_File(sf::Image*& p_sf_image, const boost::filesystem::path& filename);
+        // Decode the files from the shared index on until all are taken
+        static void Preload_Worker(const std::vector<boost::filesystem::path>* files, std::vector<sf::Image*>* images, std::atomic<size_t>* next_file);
+
+        // maximum number of threads decoding images
+        static const unsigned int m_preload_thread_limit;
+
+        // decoded images by file
+        typedef std::unordered_map<std::string, sf::Image*> PreloadedImageMap;
+        PreloadedImageMap m_preloaded_images;
     };
 
     /* Draw an Screen Fadeout Effect
@@ -274,6 +306,17 @@ namespace TSC {
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
+    /* Preloads the given images for the lifetime of the object
+     * the images which were not used are deleted on destruction
+    */
+    class cImage_Preload {
+    public:
+        cImage_Preload(const std::vector<boost::filesystem::path>& filenames);
+        ~cImage_Preload(void);
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
 } // namespace TSC
 
 #endif